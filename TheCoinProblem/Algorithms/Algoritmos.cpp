@@ -0,0 +1,54 @@
+/*
+	Problema de las monedas
+
+	Registro de todos los algoritmos disponibles
+
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
+	Universidad Complutense de Madrid
+
+	Beatriz Herguedas Pinedo
+*/
+
+#include <string>
+#include <vector>
+
+#include "Monedas.h"
+#include "Planificador.h"
+
+using namespace std;
+
+/*
+  Función que devuelve la lista de algoritmos
+
+  Los intervalos de pruebas por defecto son los que tenía cada fichero en sus constantes IT_MIN, IT_MAX y SUMA
+*/
+vector<Algoritmo> const &algoritmos() {
+	static vector<Algoritmo> const lista = {
+		// nombre       resolver             exacto  itMin    itMax    suma   resolverSinReservas            multihilo  resolverGrande
+		{ "Voraz1",      resolverVoraz1,      false,  5000000, 6500000, 10000, resolverVoraz1SinReservas,     false,     nullptr },
+		{ "Voraz2",      resolverVoraz2,      false,  10,      15,      1,     resolverVoraz2SinReservas,     false,     nullptr },
+		{ "PDVector",    resolverPDVector,    true,   10,      15,      1,     resolverPDVectorSinReservas,   false,     nullptr },
+		{ "PDParalelo",  resolverPDParalelo,  true,   10,      15,      1,     nullptr,                       true,      nullptr },
+		{ "PDMatriz",    resolverPDMatriz,    true,   1000,    4000,    200,   resolverPDMatrizSinReservas,   false,     nullptr },
+		{ "PDLimitada",  resolverPDLimitada,  true,   10,      15,      1,     resolverPDLimitadaSinReservas, false,     nullptr },
+		{ "BFS",         resolverBFS,         true,   10,      15,      1,     resolverBFSSinReservas,        false,     nullptr },
+		{ "VA",          resolverVA,          true,   10,      25,      1,     nullptr,                       false,     nullptr },
+		{ "VAParalelo",  resolverVAParalelo,  true,   10,      25,      1,     nullptr,                       true,      nullptr },
+		{ "VAPodas",     resolverVAPodas,     true,   10,      60,      1,     resolverVAPodasSinReservas,    false,     nullptr },
+		{ "RYP",         resolverRYP,         true,   10,      15,      1,     resolverRYPSinReservas,        false,     nullptr },
+		{ "RYPParalelo", resolverRYPParalelo, true,   10,      15,      1,     nullptr,                       true,      nullptr },
+		{ "Grandes",     resolverGrandes,     true,   10,      15,      1,     nullptr,                       false,     resolverGrandes64 },
+		{ "Auto",        resolverAuto,        true,   10,      15,      1,     nullptr,                       true,      nullptr },
+	};
+	return lista;
+}
+
+// Función que busca un algoritmo por su nombre
+Algoritmo const *buscarAlgoritmo(string const &nombre) {
+	for (auto const &a : algoritmos()) {
+		if (nombre == a.nombre)
+			return &a;
+	}
+	return nullptr;
+}
@@ -0,0 +1,204 @@
+/*
+	Problema de las monedas
+
+	Ejecución en paralelo de un barrido de pruebas
+
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
+	Universidad Complutense de Madrid
+
+	Beatriz Herguedas Pinedo
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "Barrido.h"
+
+using namespace std;
+
+#ifdef __linux__
+
+// Procesadores en los que el proceso puede ejecutarse
+static vector<int> procesadoresPermitidos() {
+	vector<int> p;
+	cpu_set_t conjunto;
+	CPU_ZERO(&conjunto);
+	if (sched_getaffinity(0, sizeof(conjunto), &conjunto) == 0) {
+		for (int c = 0; c < CPU_SETSIZE; ++c) {
+			if (CPU_ISSET(c, &conjunto))
+				p.push_back(c);
+		}
+	}
+	return p;
+}
+
+// Lee un entero de un fichero de /sys (-1 si no se puede)
+static int leerEntero(string const &fichero) {
+	ifstream f(fichero);
+	int x = -1;
+	if (!(f >> x))
+		return -1;
+	return x;
+}
+
+// Se queda con un procesador de cada núcleo físico (el primero de sus hilos hardware)
+static vector<int> nucleosFisicos(vector<int> const &p) {
+	vector<int> nucleos;
+	set<pair<int, int>> vistos;
+	for (int c : p) {
+		string topologia = "/sys/devices/system/cpu/cpu" + to_string(c) + "/topology/";
+		int paquete = leerEntero(topologia + "physical_package_id");
+		int nucleo = leerEntero(topologia + "core_id");
+
+		// Si no conocemos la topología tratamos cada procesador como un núcleo
+		if (paquete < 0 || nucleo < 0 || vistos.insert({ paquete, nucleo }).second)
+			nucleos.push_back(c);
+	}
+	return nucleos;
+}
+
+// Fija el hilo actual a los procesadores p (los hilos que cree después heredan los mismos)
+static void fijar(vector<int> const &p) {
+	cpu_set_t conjunto;
+	CPU_ZERO(&conjunto);
+	for (int c : p)
+		CPU_SET(c, &conjunto);
+	pthread_setaffinity_np(pthread_self(), sizeof(conjunto), &conjunto);
+}
+
+#else
+
+static vector<int> procesadoresPermitidos() {
+	return {};
+}
+
+static vector<int> nucleosFisicos(vector<int> const &p) {
+	return p;
+}
+
+static void fijar(vector<int> const &) {}
+
+#endif
+
+Barrido::Barrido(OpcionesBarrido const &opciones)
+	: numHilos(max(1, opciones.hilos)), permitidos(procesadoresPermitidos()), fijado(false) {
+	vector<int> p = permitidos;
+
+	if (opciones.aislado) {
+		p = nucleosFisicos(p);
+
+		// Reservamos el primer núcleo para este hilo y el del sumidero, y el resto es uno para cada hilo
+		if (p.size() > 1) {
+			fijar({ p[0] });
+			fijado = true;
+			p.erase(p.begin());
+		}
+		numHilos = max(1, min(numHilos, (int)p.size()));
+	}
+	else if (numHilos == 1)
+		p.clear();
+
+	// Repartimos los procesadores entre los hilos de forma circular
+	if (!p.empty()) {
+		for (int h = 0; h < numHilos; ++h)
+			procesadores.push_back(p[h % p.size()]);
+	}
+}
+
+// Si no, el hilo que ha creado el barrido se quedaría en un solo núcleo para todo lo que haga después
+Barrido::~Barrido() {
+	if (fijado)
+		fijar(permitidos);
+}
+
+int Barrido::hilos() const {
+	return numHilos;
+}
+
+void Barrido::ejecutar(int numTareas, OpcionesMedicion const &opciones, bool conContadores, Tarea const &tarea,
+	function<bool(int j)> const &multihilo, Sumidero &sumidero) const {
+
+	// Resultados terminados que todavía no se pueden enviar porque falta alguno anterior
+	vector<unique_ptr<Registro>> terminados(numTareas);
+	vector<char> hecho(numTareas, false);
+	int siguienteEnvio = 0;
+	mutex cerrojo;
+
+	// Hace la prueba j y envía todos los resultados seguidos que ya están terminados
+	auto hacer = [&](int j, Contadores *contadores) {
+		unique_ptr<Registro> r(new Registro);
+		if (!tarea(j, opciones, contadores, *r))
+			r.reset();
+
+		lock_guard<mutex> l(cerrojo);
+		terminados[j] = move(r);
+		hecho[j] = true;
+		while (siguienteEnvio < numTareas && hecho[siguienteEnvio]) {
+			if (terminados[siguienteEnvio])
+				sumidero.enviar(move(*terminados[siguienteEnvio]));
+			terminados[siguienteEnvio].reset();
+			++siguienteEnvio;
+		}
+	};
+
+	// Cada hilo abre sus contadores, que cuentan él y los hilos que cree
+	auto abrirContadores = [&]() {
+		return conContadores ? unique_ptr<Contadores>(new Contadores) : unique_ptr<Contadores>();
+	};
+
+	// Con un solo hilo sin fijar hacemos todas las pruebas en orden en el hilo actual
+	if (numHilos == 1 && procesadores.empty()) {
+		unique_ptr<Contadores> contadores = abrirContadores();
+		for (int j = 0; j < numTareas; ++j)
+			hacer(j, contadores.get());
+		return;
+	}
+
+	// Separamos las pruebas de los algoritmos que crean sus propios hilos
+	vector<int> sencillas, conHilos;
+	for (int j = 0; j < numTareas; ++j)
+		(multihilo(j) ? conHilos : sencillas).push_back(j);
+
+	// Primero las demás, repartidas entre los hilos fijados
+	atomic<size_t> siguiente(0);
+	auto trabajar = [&](int h) {
+		if (!procesadores.empty())
+			fijar({ procesadores[h] });
+		unique_ptr<Contadores> contadores = abrirContadores();
+		for (size_t k = siguiente++; k < sencillas.size(); k = siguiente++)
+			hacer(sencillas[k], contadores.get());
+	};
+
+	vector<thread> hilosBarrido;
+	for (int h = 0; h < numHilos; ++h)
+		hilosBarrido.emplace_back(trabajar, h);
+	for (thread &t : hilosBarrido)
+		t.join();
+
+	// Y después las que crean sus propios hilos, de una en una y con todos los procesadores del proceso: si su
+	// hilo estuviese fijado a un solo procesador, todos los hilos del algoritmo lo heredarían y se lo repartirían
+	if (!conHilos.empty()) {
+		thread solo([&]() {
+			if (!permitidos.empty())
+				fijar(permitidos);
+			unique_ptr<Contadores> contadores = abrirContadores();
+			for (int j : conHilos)
+				hacer(j, contadores.get());
+		});
+		solo.join();
+	}
+}
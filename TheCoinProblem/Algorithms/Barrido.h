@@ -0,0 +1,92 @@
+/*
+	Problema de las monedas
+
+	Ejecución en paralelo de un barrido de pruebas
+
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
+	Universidad Complutense de Madrid
+
+	Beatriz Herguedas Pinedo
+*/
+
+#ifndef BARRIDO_H
+#define BARRIDO_H
+
+#include <functional>
+#include <vector>
+
+#include "Contadores.h"
+#include "Medicion.h"
+#include "Resultados.h"
+
+/*
+  Opciones del barrido
+
+  - hilos, número de hilos que hacen las pruebas (con 1 se hacen en el hilo que llama, como siempre)
+  - aislado, si cada hilo tiene para él solo un núcleo físico (sin compartirlo con el otro hilo hardware
+    del núcleo ni con el hilo que escribe los resultados), para que los tiempos no se vean afectados
+*/
+struct OpcionesBarrido {
+	int hilos = 1;
+	bool aislado = false;
+};
+
+/*
+  Prueba número j de un barrido
+
+  Recibe las opciones de la medición y los contadores hardware del hilo que la ejecuta (nullptr si no se han
+  pedido), y rellena el registro con el resultado. Devuelve false si la prueba no se ha podido hacer, y no
+  debe lanzar excepciones, porque se ejecuta en los hilos del barrido
+*/
+using Tarea = std::function<bool(int j, OpcionesMedicion const &opciones, Contadores *contadores, Registro &r)>;
+
+/*
+  Clase que reparte las pruebas de un barrido entre varios hilos
+
+  Cada hilo se fija a un procesador y va cogiendo la siguiente prueba libre, así que los hilos que acaban antes
+  cogen más pruebas. Los resultados se envían al sumidero en el orden de las pruebas, sea cual sea el hilo que
+  las haga, de modo que los ficheros salen iguales que con un solo hilo
+
+  Las pruebas de los algoritmos que crean sus propios hilos no se reparten: se hacen al final, de una en una,
+  en un hilo sin fijar que puede usar todos los procesadores del proceso, para que sus hilos no compitan con
+  los del barrido ni hereden un solo procesador
+
+  En el modo aislado se usa un núcleo físico por hilo y se reserva el primero para el hilo que crea el barrido:
+  el constructor fija a él el hilo actual, así que el sumidero debe crearse después para que su hilo herede
+  ese núcleo, y el destructor (que debe ejecutarse en el mismo hilo) le devuelve los procesadores que tenía.
+  Si no hay núcleos suficientes se usan menos hilos
+*/
+class Barrido {
+public:
+	explicit Barrido(OpcionesBarrido const &opciones);
+	~Barrido();
+
+	Barrido(Barrido const &) = delete;
+	Barrido &operator=(Barrido const &) = delete;
+
+	// Número de hilos que se van a usar
+	int hilos() const;
+
+	/*
+	  Ejecuta las pruebas 0 .. numTareas - 1
+
+	  Recibe como parámetros:
+	  numTareas, el número de pruebas
+	  opciones, las opciones de la medición de cada prueba
+	  conContadores, si cada hilo tiene que abrir sus propios contadores hardware
+	  tarea, la función que hace cada prueba
+	  multihilo, que dice si la prueba j es de un algoritmo que crea sus propios hilos
+	  sumidero, al que se envían los registros en orden
+	*/
+	void ejecutar(int numTareas, OpcionesMedicion const &opciones, bool conContadores, Tarea const &tarea,
+		std::function<bool(int j)> const &multihilo, Sumidero &sumidero) const;
+
+private:
+	int numHilos;
+	std::vector<int> procesadores; // Procesador de cada hilo (vacío si no se fijan)
+	std::vector<int> permitidos; // Procesadores en los que podía ejecutarse el proceso al crear el barrido
+	bool fijado; // Si el constructor ha fijado el hilo que lo crea al núcleo reservado
+};
+
+#endif
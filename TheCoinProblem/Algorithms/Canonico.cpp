@@ -0,0 +1,152 @@
+/*
+	Problema de las monedas
+
+	Comprobación de si un sistema monetario es canónico (el método voraz siempre da la solución óptima)
+
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
+	Universidad Complutense de Madrid
+
+	Beatriz Herguedas Pinedo
+*/
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Canonico.h"
+#include "Monedas.h"
+
+using namespace std;
+
+// Cota máxima de las cantidades que comparamos sin la moneda unidad (64 MB para el vector de la programación dinámica)
+long long const MAX_LIMITE_SIN_UNIDAD = 1 << 24;
+
+/*
+  Función que calcula cuántas monedas de cada tipo coge el método voraz para la cantidad x
+
+  Recibe como parámetros:
+  d, que es el vector de tipos de monedas ordenado decrecientemente
+  x, que es la cantidad
+  g, donde escribimos cuántas monedas del tipo d[k] cogemos
+
+  Devuelve el número total de monedas, o -1 si el método voraz no alcanza x
+*/
+static long long voraz(vector<long long> const &d, long long x, vector<long long> &g) {
+	long long total = 0;
+	for (size_t k = 0; k < d.size(); ++k) {
+		g[k] = x / d[k];
+		total += g[k];
+		x %= d[k];
+	}
+	return x == 0 ? total : -1;
+}
+
+/*
+  Si el sistema no tiene la moneda unidad, no podemos usar el método de Pearson. En ese caso comparamos
+  el método voraz con la programación dinámica hasta la suma de las dos monedas más grandes, que es la cota
+  de Kozen y Zaks para el menor contraejemplo (la cota solo está demostrada para sistemas con la moneda
+  unidad, así que sin ella no encontrar contraejemplo no garantiza que el sistema sea canónico)
+
+  Si la cota pasa de MAX_LIMITE_SIN_UNIDAD no lo comprobamos y devolvemos -1 (no sabemos si es canónico)
+*/
+static long long contraejemploSinUnidad(vector<int> const &M) {
+	int N = M.size();
+	long long limite = (long long)M[N - 1] + (N > 1 ? M[N - 2] : 0);
+	if (limite > MAX_LIMITE_SIN_UNIDAD)
+		return -1;
+
+	vector<int> monedas(limite + 1, INT_MAX);
+	monedas[0] = 0;
+	for (int valor : M) {
+		for (long long j = valor; j <= limite; ++j) {
+			if (monedas[j - valor] != INT_MAX)
+				monedas[j] = min(monedas[j], monedas[j - valor] + 1);
+		}
+	}
+
+	vector<long long> d(M.rbegin(), M.rend());
+	vector<long long> g(N);
+	for (long long x = 1; x <= limite; ++x) {
+		if (monedas[x] != INT_MAX && voraz(d, x, g) != monedas[x])
+			return x;
+	}
+	return 0;
+}
+
+/*
+  Método de Pearson, en O(N^3): con las monedas ordenadas decrecientemente d[0] > d[1] > ... > d[N - 1] = 1,
+  para cada par i <= j tomamos la solución voraz de d[i - 1] - 1, nos quedamos con sus monedas de los tipos
+  0 a j - 1, añadimos una moneda más del tipo j y quitamos las demás. Si la cantidad w resultante necesita
+  más monedas con el método voraz que en esa combinación, w es un contraejemplo, y el menor contraejemplo
+  del sistema (si lo hay) es siempre uno de estos candidatos
+*/
+long long contraejemploMinimo(vector<int> const &M) {
+	int N = M.size();
+	if (N == 0)
+		return 0;
+	if (M[0] != 1)
+		return contraejemploSinUnidad(M);
+
+	vector<long long> d(M.rbegin(), M.rend());
+	vector<long long> g(N), h(N);
+	long long menor = 0;
+
+	for (int i = 1; i < N; ++i) {
+		voraz(d, d[i - 1] - 1, g);
+
+		for (int j = i; j < N; ++j) {
+			// Combinación candidata: las monedas de g hasta j - 1, y una más del tipo j
+			long long w = 0, monedas = 0;
+			for (int k = 0; k < j; ++k) {
+				w += g[k] * d[k];
+				monedas += g[k];
+			}
+			w += (g[j] + 1) * d[j];
+			monedas += g[j] + 1;
+
+			if ((menor == 0 || w < menor) && voraz(d, w, h) > monedas)
+				menor = w;
+		}
+	}
+
+	return menor;
+}
+
+bool esCanonico(vector<int> const &M) {
+	return contraejemploMinimo(M) == 0;
+}
+
+SistemaMonetario::SistemaMonetario(vector<int> const &M) : M(M), menorContraejemplo(contraejemploMinimo(M)), lotes(M) {}
+
+bool SistemaMonetario::canonico() const {
+	return menorContraejemplo == 0;
+}
+
+long long SistemaMonetario::contraejemplo() const {
+	return menorContraejemplo;
+}
+
+bool SistemaMonetario::vorazOptimo(long long C) const {
+	// Por debajo del menor contraejemplo el método voraz también es óptimo
+	// Sin la moneda unidad no podemos asegurar que sea canónico, así que solo usamos el método voraz por debajo
+	// de un contraejemplo encontrado
+	bool unidad = !M.empty() && M[0] == 1;
+	return (canonico() && unidad) || C < menorContraejemplo;
+}
+
+Resultado SistemaMonetario::resolver(int C) const {
+	if (vorazOptimo(C))
+		return resolverVoraz1(M, C);
+	return resolverPDVector(M, C);
+}
+
+void SistemaMonetario::resolverLote(int32_t const *cantidades, size_t n, int32_t *totales) const {
+	lotes.resolver(cantidades, n, nullptr, n, totales);
+	for (size_t j = 0; j < n; ++j) {
+		if (!vorazOptimo(cantidades[j]))
+			totales[j] = resolver(cantidades[j]).total;
+	}
+}
@@ -0,0 +1,76 @@
+/*
+	Problema de las monedas
+
+	Comprobación de si un sistema monetario es canónico (el método voraz siempre da la solución óptima)
+
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
+	Universidad Complutense de Madrid
+
+	Beatriz Herguedas Pinedo
+*/
+
+#ifndef CANONICO_H
+#define CANONICO_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Monedas.h"
+#include "VorazLotes.h"
+
+/*
+  Función que busca el menor contraejemplo del método voraz, es decir, la menor cantidad para la que
+  monedasVoraz1 no da la solución óptima
+
+  Recibe como parámetros:
+  M, que es el vector que contiene los tipos de monedas, ordenado crecientemente y sin repetidos
+
+  Devuelve 0 si el sistema es canónico, y si no, el menor contraejemplo (o -1 si no tiene la moneda unidad
+  y sus monedas son tan grandes que no lo hemos podido comprobar, que se trata como no canónico)
+
+  Si el sistema tiene la moneda unidad usa el método de Pearson, en O(N^3). Si no, compara el método voraz
+  con la programación dinámica hasta la suma de las dos monedas más grandes
+*/
+long long contraejemploMinimo(std::vector<int> const &M);
+
+// Función que dice si el sistema es canónico
+bool esCanonico(std::vector<int> const &M);
+
+/*
+  Clase que comprueba una sola vez si un sistema es canónico y después resuelve cada consulta
+  con el método voraz en O(N) si lo es (o si la cantidad es menor que el menor contraejemplo),
+  o con programación dinámica si no
+*/
+class SistemaMonetario {
+public:
+	// M debe estar ordenado crecientemente y sin repetidos
+	explicit SistemaMonetario(std::vector<int> const &M);
+
+	bool canonico() const;
+
+	// Menor contraejemplo del método voraz (0 si el sistema es canónico, -1 si no se sabe)
+	long long contraejemplo() const;
+
+	Resultado resolver(int C) const;
+
+	/*
+	  Resuelve las cantidades cantidades[0..n-1] (entre 0 y INT_MAX) escribiendo en totales[j] el número mínimo
+	  de monedas para cantidades[j], o INT_MAX si no se puede alcanzar
+
+	  Las cantidades para las que vale el método voraz se resuelven todas juntas con VorazLotes, sin divisiones,
+	  y el resto una a una con resolver. Si el sistema es canónico no pide memoria
+	*/
+	void resolverLote(int32_t const *cantidades, std::size_t n, int32_t *totales) const;
+
+private:
+	// Si el método voraz da el mínimo para la cantidad C
+	bool vorazOptimo(long long C) const;
+
+	std::vector<int> M;
+	long long menorContraejemplo;
+	VorazLotes lotes;
+};
+
+#endif
@@ -0,0 +1,197 @@
+/*
+	Problema de las monedas
+
+	Cantidades de 64 bits sin tabla de tamaño C
+
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
+	Universidad Complutense de Madrid
+
+	Beatriz Herguedas Pinedo
+*/
+
+#include <climits>
+#include <functional>
+#include <queue>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include "CantidadesGrandes.h"
+#include "Monedas.h"
+#include "Planificador.h"
+
+using namespace std;
+
+// Mayor umbral para el que construimos la tabla de cantidades pequeñas
+long long const MAX_UMBRAL = 1LL << 28;
+
+// Bytes por resto módulo m (mejor, suma, anterior y moneda) y por cantidad de la tabla (monedas y ultima)
+double const BYTES_RESTO = 2 * sizeof(long long) + 2 * sizeof(int);
+double const BYTES_CANTIDAD = 2 * sizeof(int);
+
+/*
+  Dijkstra sobre los restos módulo m
+
+  Cada estado es un resto a con la mejor parte pequeña encontrada para él: mejor[a] = monedas - (suma - a) / m.
+  Añadir una moneda c < m lleva al resto b = (a + c) mod m con una moneda más, y si la suma pasa de un múltiplo
+  de m ahorramos una moneda de valor m, así que el coste de la arista es 1 - (a + c) / m, que vale 0 o 1.
+  Como los costes no son negativos, Dijkstra con prioridad (mejor, suma) da para cada resto la mejor parte
+  pequeña y, entre las mejores, la de menor suma
+*/
+CantidadesGrandes::CantidadesGrandes(vector<int> const &M, double memoriaMaxima)
+	: M(M), m(M.empty() ? 1 : M.back()), tabla(M, 0) {
+	if (M.empty())
+		throw invalid_argument("CantidadesGrandes: el sistema no tiene monedas");
+	if (m > MAX_UMBRAL || BYTES_RESTO * m > memoriaMaxima)
+		throw length_error("CantidadesGrandes: la moneda más grande es demasiado grande para recorrer sus restos");
+
+	mejor.assign(m, LLONG_MAX);
+	suma.assign(m, LLONG_MAX);
+	anterior.assign(m, -1);
+	moneda.assign(m, -1);
+
+	using Estado = tuple<long long, long long, int>; // (mejor, suma, resto)
+	priority_queue<Estado, vector<Estado>, greater<Estado>> cola;
+	mejor[0] = 0;
+	suma[0] = 0;
+	cola.push(Estado(0, 0, 0));
+
+	while (!cola.empty()) {
+		long long coste, s;
+		int a;
+		tie(coste, s, a) = cola.top();
+		cola.pop();
+		if (coste != mejor[a] || s != suma[a])
+			continue;
+
+		for (int i = 0; i + 1 < (int)M.size(); ++i) {
+			long long c = M[i];
+			int b = int((a + c) % m);
+			long long nuevo = coste + 1 - (a + c) / m;
+			long long nuevaSuma = s + c;
+			if (nuevo < mejor[b] || (nuevo == mejor[b] && nuevaSuma < suma[b])) {
+				mejor[b] = nuevo;
+				suma[b] = nuevaSuma;
+				anterior[b] = a;
+				moneda[b] = i;
+				cola.push(Estado(nuevo, nuevaSuma, b));
+			}
+		}
+	}
+
+	// Las cantidades por debajo de la mayor suma se responden con la tabla
+	mayorSuma = 0;
+	for (long long r = 0; r < m; ++r) {
+		if (suma[r] != LLONG_MAX)
+			mayorSuma = max(mayorSuma, suma[r]);
+	}
+	if (mayorSuma > MAX_UMBRAL || BYTES_RESTO * m + BYTES_CANTIDAD * (mayorSuma + 1.0) > memoriaMaxima)
+		throw length_error("CantidadesGrandes: las monedas son demasiado grandes para la tabla de cantidades pequeñas");
+	tabla.ampliar((int)mayorSuma);
+}
+
+long long CantidadesGrandes::umbral() const {
+	return mayorSuma;
+}
+
+long long CantidadesGrandes::minimo(long long C) const {
+	if (C < 0)
+		return -1;
+	if (C <= mayorSuma) {
+		int n = tabla.minimo((int)C);
+		return n == INT_MAX ? -1 : n;
+	}
+
+	long long r = C % m;
+	if (mejor[r] == LLONG_MAX)
+		return -1;
+	return mejor[r] + (C - r) / m;
+}
+
+bool CantidadesGrandes::desglose(long long C, vector<long long> &cuantas) const {
+	cuantas.clear();
+	if (minimo(C) < 0)
+		return false;
+
+	cuantas.assign(M.size(), 0);
+	if (C <= mayorSuma) {
+		vector<int> c = tabla.cuantas((int)C);
+		for (size_t i = 0; i < c.size(); ++i)
+			cuantas[i] = c[i];
+		return true;
+	}
+
+	// Recorremos hacia atrás el camino de la parte pequeña y completamos con monedas de valor m
+	int r = int(C % m);
+	cuantas.back() = (C - suma[r]) / m;
+	while (anterior[r] != -1) {
+		cuantas[moneda[r]]++;
+		r = anterior[r];
+	}
+	return true;
+}
+
+/*
+  Adaptador de CantidadesGrandes a la interfaz común
+
+  Preprocesar el sistema cuesta O(m * N * log m) y la tabla de cantidades pequeñas llega hasta m por la segunda
+  moneda, así que si C no pasa de ese producto la programación dinámica con vector hasta C es más barata y da
+  el mismo resultado. Si las monedas son demasiado grandes para preprocesarlas dentro de la memoria máxima
+  del planificador, devolvemos que no hay solución
+*/
+Resultado resolverGrandes(vector<int> const &M, int C) {
+	Resultado r;
+	if (M.empty())
+		return r;
+
+	long long segunda = M.size() > 1 ? M[M.size() - 2] : 1;
+	if (C <= (long long)M.back() * segunda)
+		return resolverPDVector(M, C);
+
+	try {
+		CantidadesGrandes g(M, planificadorPorDefecto().memoriaMaxima);
+		vector<long long> cuantas;
+		if (g.desglose(C, cuantas)) {
+			r.total = (int)g.minimo(C);
+			r.cuantas.assign(cuantas.begin(), cuantas.end());
+		}
+	}
+	catch (exception const &) {
+		// No se puede preprocesar (length_error) o no hay memoria suficiente (bad_alloc)
+	}
+	return r;
+}
+
+/*
+  Adaptador de CantidadesGrandes para cantidades de 64 bits
+
+  Hasta INT_MAX es igual que resolverGrandes. Por encima, el número de monedas y el desglose se devuelven
+  en int como en la interfaz común, así que si no caben se lanza overflow_error
+*/
+Resultado resolverGrandes64(vector<int> const &M, long long C) {
+	if (C <= INT_MAX)
+		return resolverGrandes(M, (int)C);
+
+	Resultado r;
+	if (M.empty())
+		return r;
+
+	long long total = -1;
+	vector<long long> cuantas;
+	try {
+		CantidadesGrandes g(M, planificadorPorDefecto().memoriaMaxima);
+		if (g.desglose(C, cuantas))
+			total = g.minimo(C);
+	}
+	catch (exception const &) {
+		// No se puede preprocesar (length_error) o no hay memoria suficiente (bad_alloc)
+	}
+	if (total < 0)
+		return r;
+	if (total > INT_MAX)
+		throw overflow_error("resolverGrandes64: el número de monedas no cabe en int");
+	r.total = (int)total;
+	r.cuantas.assign(cuantas.begin(), cuantas.end());
+	return r;
+}
@@ -0,0 +1,76 @@
+/*
+	Problema de las monedas
+
+	Cantidades de 64 bits sin tabla de tamaño C
+
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
+	Universidad Complutense de Madrid
+
+	Beatriz Herguedas Pinedo
+*/
+
+#ifndef CANTIDADESGRANDES_H
+#define CANTIDADESGRANDES_H
+
+#include <vector>
+
+#include "TablaCambio.h"
+
+/*
+  Clase que resuelve el problema para cantidades C de 64 bits con tiempo y memoria que dependen
+  de las monedas y no de C
+
+  Sea m la moneda más grande. Entre m o más monedas más pequeñas siempre hay algunas cuya suma es múltiplo
+  de m (por el principio del palomar sobre las sumas parciales módulo m), y se pueden cambiar por monedas
+  de valor m sin usar más monedas. Así que hay una solución óptima formada por q monedas de valor m y una
+  "parte pequeña" de menos de m monedas más pequeñas, con suma r congruente con C módulo m
+
+  Para cada resto módulo m calculamos, con el algoritmo de Dijkstra sobre los m restos, la parte pequeña que
+  minimiza (monedas de la parte pequeña) - (r - resto) / m, y nos quedamos con la de menor suma r.
+  Para C >= r la solución es esa parte pequeña más (C - r) / m monedas de valor m. Las cantidades menores
+  que la mayor de esas sumas r (que está acotada por m por la segunda moneda más grande) se responden con
+  una TablaCambio
+
+  Hipótesis:
+  1. Cantidad de monedas disponible de cada tipo ilimitada
+  2. Los tipos de monedas están ordenados en orden estrictamente creciente
+*/
+class CantidadesGrandes {
+public:
+	/*
+	  Preprocesa el sistema monetario en O(m * N * log m)
+
+	  Lanza length_error si m o la tabla de cantidades pequeñas son demasiado grandes, o si entre los restos
+	  y la tabla pasan de memoriaMaxima bytes (1 GB por defecto, como en el planificador)
+	*/
+	explicit CantidadesGrandes(std::vector<int> const &M, double memoriaMaxima = 1e9);
+
+	// Número mínimo de monedas para alcanzar C, o -1 si no se puede alcanzar
+	long long minimo(long long C) const;
+
+	/*
+	  Función que calcula cuántas monedas del tipo M[i] se usan para alcanzar C
+
+	  Devuelve false (y deja cuantas vacío) si C no se puede alcanzar
+	*/
+	bool desglose(long long C, std::vector<long long> &cuantas) const;
+
+	// Mayor cantidad que se responde con la tabla (por encima se usa la periodicidad)
+	long long umbral() const;
+
+private:
+	std::vector<int> M;
+	long long m;
+
+	// Para cada resto módulo m: la mejor parte pequeña, su suma, y de qué resto y con qué moneda llegamos a él
+	std::vector<long long> mejor;
+	std::vector<long long> suma;
+	std::vector<int> anterior;
+	std::vector<int> moneda;
+
+	long long mayorSuma;
+	TablaCambio tabla;
+};
+
+#endif
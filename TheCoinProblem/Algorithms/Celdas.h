@@ -0,0 +1,57 @@
+/*
+	Problema de las monedas
+
+	Tipos de celda de las tablas de programación dinámica
+
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
+	Universidad Complutense de Madrid
+
+	Beatriz Herguedas Pinedo
+*/
+
+#ifndef CELDAS_H
+#define CELDAS_H
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+/*
+  Valor que representa "infinito" (cantidad que no se puede alcanzar) en una celda de tipo T
+
+  Es el máximo del tipo menos 1, así que sumarle 1 nunca se desborda y min(a, b + 1) se queda en infinito
+  sin necesidad de comprobarlo
+*/
+template <typename T>
+constexpr T infinito() {
+	return std::numeric_limits<T>::max() - 1;
+}
+
+/*
+  Función que calcula una cota superior del número mínimo de monedas para alcanzar C:
+  si la cantidad se puede alcanzar, nunca hacen falta más de C / (moneda más pequeña) monedas
+*/
+inline long long cotaMonedas(std::vector<int> const &v, int C) {
+	if (v.empty())
+		return 0;
+	return C / *std::min_element(v.begin(), v.end());
+}
+
+/*
+  Función que llama a f con el tipo de celda más estrecho (uint8_t, uint16_t o uint32_t) en el que cabe cota
+  sin llegar a infinito, pasándole un valor de ese tipo para que lo deduzca
+
+  Con celdas de 1 o 2 bytes en vez de 4, caben 4 o 2 veces más cantidades en la caché y en la memoria
+*/
+template <typename F>
+auto segunCelda(long long cota, F f) -> decltype(f(uint32_t())) {
+	if (cota < infinito<uint8_t>())
+		return f(uint8_t());
+	if (cota < infinito<uint16_t>())
+		return f(uint16_t());
+	return f(uint32_t());
+}
+
+#endif
@@ -0,0 +1,148 @@
+/*
+	Problema de las monedas
+
+	Contadores hardware de rendimiento (perf_event_open de Linux)
+
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
+	Universidad Complutense de Madrid
+
+	Beatriz Herguedas Pinedo
+*/
+
+#include <cstdint>
+#include <cstring>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "Contadores.h"
+
+using namespace std;
+
+char const *Contadores::nombre(int c) {
+	static char const *const nombres[NUM_CONTADORES] = {
+		"ciclos", "instrucciones", "fallosL1", "fallosLLC", "fallosSalto", "fallosDTLB"
+	};
+	return nombres[c];
+}
+
+#ifdef __linux__
+
+/*
+  Función que abre un contador para el hilo actual en cualquier CPU, inicialmente desactivado
+
+  Con inherit el contador también cuenta los hilos que se creen después de abrirlo: cuando uno termina, su cuenta
+  se suma a la del contador, así que los algoritmos paralelos (que crean y esperan a sus hilos en cada llamada)
+  se miden completos. A cambio no se pueden leer los contadores en grupo, y se leen uno por uno
+*/
+static int abrir(uint32_t tipo, uint64_t config) {
+	perf_event_attr attr;
+	memset(&attr, 0, sizeof(attr));
+	attr.size = sizeof(attr);
+	attr.type = tipo;
+	attr.config = config;
+	attr.disabled = 1;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	attr.inherit = 1;
+	attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+	return (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+// Configuración de los eventos de caché: fallos de lectura en el nivel indicado
+static uint64_t fallosLectura(uint64_t cache) {
+	return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+}
+
+Contadores::Contadores() {
+	fd[CICLOS] = abrir(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+	fd[INSTRUCCIONES] = abrir(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+	fd[FALLOS_L1] = abrir(PERF_TYPE_HW_CACHE, fallosLectura(PERF_COUNT_HW_CACHE_L1D));
+	fd[FALLOS_LLC] = abrir(PERF_TYPE_HW_CACHE, fallosLectura(PERF_COUNT_HW_CACHE_LL));
+	fd[FALLOS_SALTO] = abrir(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+	fd[FALLOS_DTLB] = abrir(PERF_TYPE_HW_CACHE, fallosLectura(PERF_COUNT_HW_CACHE_DTLB));
+	memset(inicio, 0, sizeof(inicio));
+}
+
+Contadores::~Contadores() {
+	for (int c = 0; c < NUM_CONTADORES; ++c) {
+		if (fd[c] >= 0)
+			close(fd[c]);
+	}
+}
+
+// Lee el valor, el tiempo activado y el tiempo realmente contando del contador abierto en fd
+static bool leerContador(int fd, uint64_t datos[3]) {
+	return fd >= 0 && read(fd, datos, 3 * sizeof(uint64_t)) == (ssize_t)(3 * sizeof(uint64_t));
+}
+
+/*
+  PERF_EVENT_IOC_RESET no pone a cero lo que han sumado los hilos que ya han terminado, así que además
+  guardamos la lectura de partida y leer devuelve la diferencia
+*/
+void Contadores::iniciar() {
+	for (int c = 0; c < NUM_CONTADORES; ++c) {
+		if (fd[c] >= 0) {
+			ioctl(fd[c], PERF_EVENT_IOC_RESET, 0);
+			if (!leerContador(fd[c], inicio[c]))
+				inicio[c][0] = inicio[c][1] = inicio[c][2] = 0;
+			ioctl(fd[c], PERF_EVENT_IOC_ENABLE, 0);
+		}
+	}
+}
+
+void Contadores::parar() {
+	for (int c = 0; c < NUM_CONTADORES; ++c) {
+		if (fd[c] >= 0)
+			ioctl(fd[c], PERF_EVENT_IOC_DISABLE, 0);
+	}
+}
+
+Lecturas Contadores::leer() const {
+	Lecturas l;
+	for (int c = 0; c < NUM_CONTADORES; ++c) {
+		// Formato de lectura: valor, tiempo activado y tiempo realmente contando, desde iniciar
+		uint64_t datos[3];
+		if (!leerContador(fd[c], datos))
+			continue;
+		for (int k = 0; k < 3; ++k)
+			datos[k] -= inicio[c][k];
+
+		// Si el núcleo ha multiplexado el contador, escalamos la cuenta al tiempo total
+		l.valido[c] = true;
+		l.valor[c] = datos[2] > 0 ? double(datos[0]) * double(datos[1]) / double(datos[2]) : 0;
+	}
+	return l;
+}
+
+#else
+
+Contadores::Contadores() {
+	for (int c = 0; c < NUM_CONTADORES; ++c)
+		fd[c] = -1;
+}
+
+Contadores::~Contadores() {}
+
+void Contadores::iniciar() {}
+
+void Contadores::parar() {}
+
+Lecturas Contadores::leer() const {
+	return Lecturas();
+}
+
+#endif
+
+bool Contadores::disponible() const {
+	for (int c = 0; c < NUM_CONTADORES; ++c) {
+		if (fd[c] >= 0)
+			return true;
+	}
+	return false;
+}
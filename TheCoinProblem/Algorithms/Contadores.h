@@ -0,0 +1,76 @@
+/*
+	Problema de las monedas
+
+	Contadores hardware de rendimiento (perf_event_open de Linux)
+
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
+	Universidad Complutense de Madrid
+
+	Beatriz Herguedas Pinedo
+*/
+
+#ifndef CONTADORES_H
+#define CONTADORES_H
+
+#include <cstdint>
+
+// Contadores que registramos alrededor de cada prueba
+enum Contador {
+	CICLOS,
+	INSTRUCCIONES,
+	FALLOS_L1,
+	FALLOS_LLC,
+	FALLOS_SALTO,
+	FALLOS_DTLB,
+	NUM_CONTADORES
+};
+
+/*
+  Lecturas de los contadores
+
+  - valor, la cuenta de cada contador (escalada si el núcleo lo ha multiplexado)
+  - valido, si el contador se ha podido abrir en esta máquina
+*/
+struct Lecturas {
+	double valor[NUM_CONTADORES] = {};
+	bool valido[NUM_CONTADORES] = {};
+};
+
+/*
+  Clase que abre los contadores para el hilo actual
+
+  Los contadores también cuentan los hilos que cree el hilo actual después de abrirlos, una vez que terminan,
+  así que los algoritmos paralelos se miden con todos sus hilos
+
+  En sistemas que no son Linux, o si el núcleo no permite abrirlos (perf_event_paranoid),
+  los contadores no están disponibles y las lecturas se marcan como no válidas
+*/
+class Contadores {
+public:
+	Contadores();
+	~Contadores();
+	Contadores(Contadores const &) = delete;
+	Contadores &operator=(Contadores const &) = delete;
+
+	// Si se ha podido abrir al menos un contador
+	bool disponible() const;
+
+	// Pone a cero y activa los contadores
+	void iniciar();
+
+	// Detiene los contadores
+	void parar();
+
+	// Lee los contadores (acumulado entre iniciar y parar)
+	Lecturas leer() const;
+
+	// Nombre de cada contador para las cabeceras de los ficheros
+	static char const *nombre(int c);
+
+private:
+	int fd[NUM_CONTADORES];
+	uint64_t inicio[NUM_CONTADORES][3]; // Lectura al iniciar (valor, tiempo activado y tiempo contando)
+};
+
+#endif
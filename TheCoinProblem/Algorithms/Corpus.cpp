@@ -0,0 +1,181 @@
+/*
+	Problema de las monedas
+
+	Corpus binario de entradas compartido por todas las pruebas
+
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
+	Universidad Complutense de Madrid
+
+	Beatriz Herguedas Pinedo
+*/
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define CORPUS_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "Corpus.h"
+
+using namespace std;
+
+static char const MARCA[8] = { 'M', 'O', 'N', 'E', 'D', 'A', 'S', '1' };
+uint32_t const VERSION = 1;
+
+/*
+  Función que comprueba una entrada del índice: que sus monedas están dentro del fichero (sin desbordar al
+  sumar), alineadas para leerlas como enteros de 32 bits, y que son positivas y estrictamente crecientes,
+  que es lo que suponen todos los algoritmos (una moneda 0 haría dividir entre 0 al método voraz)
+*/
+static bool instanciaValida(unsigned char const *datos, size_t tam, IndiceCorpus const &e) {
+	if (e.familia >= NUM_FAMILIAS || e.N < 0 || e.C < 0 || e.numMonedas > (uint32_t)INT_MAX)
+		return false;
+	if (e.posicion > tam || e.numMonedas > (tam - e.posicion) / sizeof(int32_t) || e.posicion % alignof(int32_t) != 0)
+		return false;
+
+	int32_t const *monedas = (int32_t const *)(datos + e.posicion);
+	for (uint32_t i = 0; i < e.numMonedas; ++i) {
+		if (monedas[i] <= 0 || (i > 0 && monedas[i] <= monedas[i - 1]))
+			return false;
+	}
+	return true;
+}
+
+vector<int> Instancia::tipos() const {
+	return vector<int>(monedas, monedas + numMonedas);
+}
+
+Corpus::Corpus(string const &fichero) : datos(nullptr), tam(0) {
+#ifdef CORPUS_MMAP
+	int fd = open(fichero.c_str(), O_RDONLY);
+	if (fd < 0)
+		throw runtime_error("Corpus: no se puede abrir " + fichero);
+	struct stat info;
+	if (fstat(fd, &info) != 0 || info.st_size == 0) {
+		close(fd);
+		throw runtime_error("Corpus: no se puede leer " + fichero);
+	}
+	tam = info.st_size;
+	void *p = mmap(nullptr, tam, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (p == MAP_FAILED)
+		throw runtime_error("Corpus: no se puede proyectar " + fichero);
+	datos = (unsigned char const *)p;
+#else
+	ifstream entrada(fichero, ios::binary);
+	if (!entrada)
+		throw runtime_error("Corpus: no se puede abrir " + fichero);
+	copia.assign(istreambuf_iterator<char>(entrada), istreambuf_iterator<char>());
+	datos = copia.data();
+	tam = copia.size();
+#endif
+
+	cabecera = (CabeceraCorpus const *)datos;
+	indice = (IndiceCorpus const *)(datos + sizeof(CabeceraCorpus));
+	bool valido = tam >= sizeof(CabeceraCorpus) && memcmp(cabecera->marca, MARCA, sizeof(MARCA)) == 0 &&
+		cabecera->version == VERSION &&
+		sizeof(CabeceraCorpus) + (uint64_t)cabecera->numInstancias * sizeof(IndiceCorpus) <= tam;
+
+	// Comprobamos todas las instancias y que el índice esté ordenado, porque buscar hace búsqueda binaria
+	for (uint32_t i = 0; valido && i < cabecera->numInstancias; ++i) {
+		valido = instanciaValida(datos, tam, indice[i]) &&
+			(i == 0 || make_pair(indice[i - 1].familia, indice[i - 1].N) < make_pair(indice[i].familia, indice[i].N));
+	}
+	if (!valido) {
+		cerrar();
+		throw runtime_error("Corpus: " + fichero + " no es un corpus válido");
+	}
+}
+
+Corpus::~Corpus() {
+	cerrar();
+}
+
+void Corpus::cerrar() {
+#ifdef CORPUS_MMAP
+	if (datos != nullptr)
+		munmap((void *)datos, tam);
+#endif
+	datos = nullptr;
+}
+
+uint64_t Corpus::semilla() const {
+	return cabecera->semilla;
+}
+
+size_t Corpus::size() const {
+	return cabecera->numInstancias;
+}
+
+Instancia Corpus::operator[](size_t i) const {
+	IndiceCorpus const &e = indice[i];
+	return { Familia(e.familia), e.N, e.C, (int32_t const *)(datos + e.posicion), (int)e.numMonedas };
+}
+
+bool Corpus::buscar(Familia f, int N, Instancia &instancia) const {
+	IndiceCorpus const *fin = indice + cabecera->numInstancias;
+	IndiceCorpus const *e = lower_bound(indice, fin, make_pair((uint32_t)f, N), [](IndiceCorpus const &a, pair<uint32_t, int> const &b) {
+		return make_pair(a.familia, a.N) < b;
+	});
+	if (e == fin || e->familia != (uint32_t)f || e->N != N)
+		return false;
+	instancia = (*this)[e - indice];
+	return true;
+}
+
+void Corpus::escribir(string const &fichero, Generador const &generador, vector<Familia> const &familias, vector<int> const &numTipos) {
+	// Ordenamos las familias y los tamaños para que el índice quede ordenado, y quitamos los repetidos
+	vector<Familia> fs = familias;
+	sort(fs.begin(), fs.end());
+	fs.erase(unique(fs.begin(), fs.end()), fs.end());
+	vector<int> ns = numTipos;
+	sort(ns.begin(), ns.end());
+	ns.erase(unique(ns.begin(), ns.end()), ns.end());
+
+	int hilos = max(1u, thread::hardware_concurrency());
+	vector<vector<int>> sistemas;
+	vector<IndiceCorpus> indice;
+	for (Familia f : fs) {
+		vector<vector<int>> generados = generador.monedas(f, ns, hilos);
+		for (size_t i = 0; i < ns.size(); ++i) {
+			indice.push_back({ (uint32_t)f, ns[i], 2 * ns[i], (uint32_t)generados[i].size(), 0 });
+			sistemas.push_back(move(generados[i]));
+		}
+	}
+
+	CabeceraCorpus cabecera;
+	memcpy(cabecera.marca, MARCA, sizeof(MARCA));
+	cabecera.version = VERSION;
+	cabecera.numInstancias = (uint32_t)indice.size();
+	cabecera.semilla = generador.semilla();
+
+	uint64_t posicion = sizeof(CabeceraCorpus) + indice.size() * sizeof(IndiceCorpus);
+	for (IndiceCorpus &e : indice) {
+		e.posicion = posicion;
+		posicion += (uint64_t)e.numMonedas * sizeof(int32_t);
+	}
+
+	ofstream salida(fichero, ios::binary);
+	salida.write((char const *)&cabecera, sizeof(cabecera));
+	salida.write((char const *)indice.data(), indice.size() * sizeof(IndiceCorpus));
+	for (vector<int> const &s : sistemas) {
+		vector<int32_t> monedas(s.begin(), s.end());
+		salida.write((char const *)monedas.data(), monedas.size() * sizeof(int32_t));
+	}
+	if (!salida)
+		throw runtime_error("Corpus: no se puede escribir " + fichero);
+}
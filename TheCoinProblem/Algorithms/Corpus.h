@@ -0,0 +1,108 @@
+/*
+	Problema de las monedas
+
+	Corpus binario de entradas compartido por todas las pruebas
+
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
+	Universidad Complutense de Madrid
+
+	Beatriz Herguedas Pinedo
+*/
+
+#ifndef CORPUS_H
+#define CORPUS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Generador.h"
+
+/*
+  Formato del fichero (con el orden de bytes de la máquina que lo escribe):
+
+  - Cabecera: la marca "MONEDAS1", la versión, el número de entradas y la semilla con que se generaron
+  - Índice: una entrada por instancia (familia, N, C, número de monedas y posición de las monedas en el
+    fichero), ordenado por familia y N para buscar con búsqueda binaria
+  - Datos: las monedas de cada instancia como enteros de 32 bits, ordenadas crecientemente
+*/
+struct CabeceraCorpus {
+	char marca[8];
+	uint32_t version;
+	uint32_t numInstancias;
+	uint64_t semilla;
+};
+
+struct IndiceCorpus {
+	uint32_t familia;
+	int32_t N;
+	int32_t C;
+	uint32_t numMonedas;
+	uint64_t posicion;
+};
+
+/*
+  Instancia del corpus
+
+  monedas apunta directamente a la proyección del fichero en memoria, así que solo es válida mientras el
+  Corpus esté abierto
+*/
+struct Instancia {
+	Familia familia;
+	int N;
+	int C;
+	int32_t const *monedas;
+	int numMonedas;
+
+	// Copia las monedas a un vector, que es lo que reciben los algoritmos
+	std::vector<int> tipos() const;
+};
+
+/*
+  Clase que abre un corpus proyectándolo en memoria con mmap (o leyéndolo entero si el sistema no tiene mmap),
+  sin analizar nada: las instancias se leen directamente de la proyección
+
+  Lanza runtime_error si el fichero no existe o no es un corpus válido. Al abrirlo se comprueban todas las
+  instancias (monedas dentro del fichero, alineadas, positivas y estrictamente crecientes, e índice ordenado),
+  así que después se pueden leer sin más comprobaciones
+*/
+class Corpus {
+public:
+	explicit Corpus(std::string const &fichero);
+	~Corpus();
+
+	Corpus(Corpus const &) = delete;
+	Corpus &operator=(Corpus const &) = delete;
+
+	// Semilla con la que se generaron las instancias
+	uint64_t semilla() const;
+
+	std::size_t size() const;
+	Instancia operator[](std::size_t i) const;
+
+	// Busca la instancia de la familia f con N tipos de monedas; devuelve false si no está
+	bool buscar(Familia f, int N, Instancia &instancia) const;
+
+	/*
+	  Genera un corpus con el generador y lo escribe en fichero
+
+	  Contiene, para cada familia de familias y cada N de numTipos, el sistema generador.monedas(familia, N)
+	  con la cantidad C = 2 * N de las pruebas. Lanza runtime_error si no se puede escribir
+	*/
+	static void escribir(std::string const &fichero, Generador const &generador, std::vector<Familia> const &familias,
+		std::vector<int> const &numTipos);
+
+private:
+	// Deshace la proyección del fichero
+	void cerrar();
+
+	unsigned char const *datos;
+	std::size_t tam;
+	std::vector<unsigned char> copia; // Solo si el sistema no tiene mmap
+	CabeceraCorpus const *cabecera;
+	IndiceCorpus const *indice;
+};
+
+#endif
@@ -0,0 +1,130 @@
+/*
+	Problema de las monedas
+
+	Generador reproducible de sistemas monetarios
+
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
+	Universidad Complutense de Madrid
+
+	Beatriz Herguedas Pinedo
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Generador.h"
+
+using namespace std;
+
+static char const *const NOMBRES[NUM_FAMILIAS] = { "potencias", "multiplos", "aleatorio", "sinunidad" };
+
+char const *nombreFamilia(Familia f) {
+	return NOMBRES[f];
+}
+
+bool buscarFamilia(string const &nombre, Familia &f) {
+	for (int i = 0; i < NUM_FAMILIAS; ++i) {
+		if (nombre == NOMBRES[i]) {
+			f = Familia(i);
+			return true;
+		}
+	}
+	return false;
+}
+
+// Paso de splitmix64: mezcla bien los bits, así que semillas parecidas dan generadores independientes
+static uint64_t mezclar(uint64_t x) {
+	x += 0x9E3779B97F4A7C15ULL;
+	x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+	return x ^ (x >> 31);
+}
+
+/*
+  Añade a tiposMonedas, en orden creciente, n valores distintos elegidos al azar entre los R valores 2..R + 1
+
+  Usa el algoritmo de Floyd: para j desde R - n hasta R - 1 tomamos t al azar en [0, j], y si ya estaba tomamos j
+  en su lugar. Cada subconjunto sale con la misma probabilidad y no se repite ningún sorteo. Marcamos los elegidos
+  en un vector de R posiciones y lo recorremos en orden, así que salen ya ordenados sin ordenar nada
+*/
+static void elegirDistintos(mt19937_64 &motor, int n, int R, vector<int> &tiposMonedas) {
+	vector<char> elegido(R, 0);
+	for (int j = R - n; j < R; ++j) {
+		int t = uniform_int_distribution<int>(0, j)(motor);
+		elegido[elegido[t] ? j : t] = 1;
+	}
+	for (int t = 0; t < R; ++t) {
+		if (elegido[t])
+			tiposMonedas.push_back(t + 2);
+	}
+}
+
+Generador::Generador(uint64_t semilla) : base(semilla) {}
+
+uint64_t Generador::semilla() const {
+	return base;
+}
+
+uint64_t Generador::semillaAleatoria() {
+	random_device dispositivo;
+	uint64_t s = (uint64_t(dispositivo()) << 32) ^ dispositivo();
+	return mezclar(s ^ (uint64_t)chrono::steady_clock::now().time_since_epoch().count());
+}
+
+vector<int> Generador::monedas(Familia f, int N) const {
+	mt19937_64 motor(mezclar(mezclar(base) ^ (uint64_t(f) << 32 | uint32_t(N))));
+
+	// Creamos el vector que va a almacenar los tipos de monedas e insertamos un 1 (salvo en la familia sin unidad)
+	vector<int> tiposMonedas;
+	tiposMonedas.reserve(max(1, N));
+	if (f != SINUNIDAD)
+		tiposMonedas.push_back(1);
+
+	if (f == POTENCIAS || f == MULTIPLOS) {
+		uniform_int_distribution<int> factor(2, 4);
+		int valorMoneda = 1;
+		for (int i = 1; i < N; i++) {
+			// El multiplicador es siempre la base 2 para las potencias, o un valor aleatorio entre 2 y 4
+			int multiplicador = f == POTENCIAS ? 2 : factor(motor);
+
+			// Si la siguiente moneda se sale de rango, dejamos de insertar
+			if (valorMoneda > INT_MAX / multiplicador)
+				break;
+
+			valorMoneda *= multiplicador;
+			tiposMonedas.push_back(valorMoneda);
+		}
+	}
+	// Junto a la unidad, N - 1 valores distintos entre 2 y 4 * N
+	else if (f == ALEATORIO && N > 1)
+		elegirDistintos(motor, N - 1, 4 * N - 1, tiposMonedas);
+	// Sin la unidad, N valores distintos entre 2 y 4 * N + 1
+	else if (f == SINUNIDAD && N > 0)
+		elegirDistintos(motor, N, 4 * N, tiposMonedas);
+
+	return tiposMonedas;
+}
+
+vector<vector<int>> Generador::monedas(Familia f, vector<int> const &numTipos, int hilos) const {
+	vector<vector<int>> sistemas(numTipos.size());
+	atomic<size_t> siguiente(0);
+	auto trabajar = [&]() {
+		for (size_t i = siguiente++; i < numTipos.size(); i = siguiente++)
+			sistemas[i] = monedas(f, numTipos[i]);
+	};
+
+	vector<thread> pool;
+	for (int h = 1; h < hilos; ++h)
+		pool.emplace_back(trabajar);
+	trabajar();
+	for (thread &t : pool)
+		t.join();
+	return sistemas;
+}
@@ -0,0 +1,65 @@
+/*
+	Problema de las monedas
+
+	Generador reproducible de sistemas monetarios
+
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
+	Universidad Complutense de Madrid
+
+	Beatriz Herguedas Pinedo
+*/
+
+#ifndef GENERADOR_H
+#define GENERADOR_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Familias de sistemas monetarios que generamos
+enum Familia {
+	POTENCIAS, // las potencias de 2 entre 0 y N - 1 (las hipótesis de monedasVoraz1 y vueltaAtras)
+	MULTIPLOS, // cada moneda es múltiplo de la anterior por un factor entre 2 y 4 (las hipótesis de monedasVoraz2)
+	ALEATORIO, // la moneda unidad y N - 1 monedas aleatorias distintas entre 2 y 4 * N
+	SINUNIDAD, // N monedas aleatorias distintas entre 2 y 4 * N + 1, sin la moneda unidad (hay cantidades que no se alcanzan)
+	NUM_FAMILIAS
+};
+
+// Nombre de la familia en la línea de órdenes ("potencias", "multiplos", "aleatorio" o "sinunidad")
+char const *nombreFamilia(Familia f);
+
+// Busca la familia con ese nombre; devuelve false si no existe
+bool buscarFamilia(std::string const &nombre, Familia &f);
+
+/*
+  Clase que genera los sistemas monetarios de las pruebas a partir de una semilla de 64 bits
+
+  Cada sistema depende solo de la semilla, la familia y N: su generador se inicializa con una mezcla de los
+  tres, así que se obtiene el mismo sistema se genere en el orden que se genere y desde el hilo que sea, y dos
+  ejecuciones con la misma semilla prueban exactamente las mismas entradas
+*/
+class Generador {
+public:
+	explicit Generador(uint64_t semilla);
+
+	uint64_t semilla() const;
+
+	/*
+	  Genera N tipos de monedas de la familia f, ordenados crecientemente y sin repetidos, en O(N)
+
+	  En las familias de potencias y múltiplos dejamos de añadir monedas si la siguiente se sale de int
+	*/
+	std::vector<int> monedas(Familia f, int N) const;
+
+	// Genera un sistema por cada N de numTipos, en paralelo con hilos hilos (el resultado no depende de hilos)
+	std::vector<std::vector<int>> monedas(Familia f, std::vector<int> const &numTipos, int hilos) const;
+
+	// Semilla elegida a partir del reloj y de std::random_device, para cuando no se indica ninguna
+	static uint64_t semillaAleatoria();
+
+private:
+	uint64_t base;
+};
+
+#endif
@@ -0,0 +1,88 @@
+/*
+	Problema de las monedas
+
+	Medición de tiempos con reloj monótono de alta resolución
+
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
+	Universidad Complutense de Madrid
+
+	Beatriz Herguedas Pinedo
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+#include "Medicion.h"
+
+using namespace std;
+
+// Reloj monótono: high_resolution_clock solo si es estable, si no steady_clock
+using Reloj = conditional<chrono::high_resolution_clock::is_steady, chrono::high_resolution_clock, chrono::steady_clock>::type;
+
+// Función que ejecuta lote veces f y devuelve los segundos transcurridos
+static double cronometrar(function<void()> const &f, long long lote) {
+	auto t0 = Reloj::now();
+	for (long long i = 0; i < lote; ++i)
+		f();
+	auto t1 = Reloj::now();
+	return chrono::duration<double>(t1 - t0).count();
+}
+
+Estadisticas medir(function<void()> const &f, OpcionesMedicion const &opciones, Contadores *contadores) {
+	Estadisticas e;
+
+	// Calentamiento
+	for (int i = 0; i < opciones.calentamiento; ++i)
+		f();
+
+	// Calculamos el tamaño del lote doblándolo hasta que la muestra dure lo suficiente
+	long long lote = 1;
+	double t = cronometrar(f, lote);
+	while (t < opciones.minimoMuestra && lote < (1LL << 40)) {
+		// Estimamos cuántas ejecuciones hacen falta, sin crecer más de 100 veces de golpe
+		long long siguiente = t > 0 ? (long long)ceil(lote * opciones.minimoMuestra / t) : lote * 100;
+		lote = min(max(siguiente, lote * 2), lote * 100);
+		t = cronometrar(f, lote);
+	}
+	e.lote = lote;
+
+	// Tomamos las muestras
+	int n = max(1, opciones.repeticiones);
+	vector<double> muestras(n);
+	if (contadores)
+		contadores->iniciar();
+	for (int i = 0; i < n; ++i)
+		muestras[i] = cronometrar(f, lote) / lote;
+	if (contadores) {
+		contadores->parar();
+
+		// Nos quedamos con la media por ejecución
+		e.contadores = contadores->leer();
+		for (int c = 0; c < NUM_CONTADORES; ++c)
+			e.contadores.valor[c] /= double(n) * lote;
+	}
+	sort(muestras.begin(), muestras.end());
+
+	// Y calculamos las estadísticas
+	e.repeticiones = n;
+	e.minimo = muestras[0];
+	e.mediana = n % 2 ? muestras[n / 2] : (muestras[n / 2 - 1] + muestras[n / 2]) / 2;
+
+	double suma = 0;
+	for (double m : muestras)
+		suma += m;
+	e.media = suma / n;
+
+	double cuadrados = 0;
+	for (double m : muestras)
+		cuadrados += (m - e.media) * (m - e.media);
+	e.desviacion = n > 1 ? sqrt(cuadrados / (n - 1)) : 0;
+
+	// Percentil 99 por el método del rango más cercano
+	e.p99 = muestras[min(n - 1, (int)ceil(0.99 * n) - 1)];
+
+	return e;
+}
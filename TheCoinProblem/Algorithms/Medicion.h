@@ -0,0 +1,58 @@
+/*
+	Problema de las monedas
+
+	Medición de tiempos con reloj monótono de alta resolución
+
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
+	Universidad Complutense de Madrid
+
+	Beatriz Herguedas Pinedo
+*/
+
+#ifndef MEDICION_H
+#define MEDICION_H
+
+#include <functional>
+
+#include "Contadores.h"
+
+/*
+  Opciones de la medición
+
+  - calentamiento, número de ejecuciones previas que no se miden
+  - repeticiones, número de muestras que se toman
+  - minimoMuestra, duración mínima (en segundos) de cada muestra: si una ejecución dura menos,
+    se agrupan varias en la misma muestra y se divide el tiempo entre el tamaño del lote
+*/
+struct OpcionesMedicion {
+	int calentamiento = 2;
+	int repeticiones = 10;
+	double minimoMuestra = 1e-3;
+};
+
+/*
+  Estadísticas de los tiempos (en segundos) de una ejecución
+*/
+struct Estadisticas {
+	double minimo = 0;
+	double mediana = 0;
+	double media = 0;
+	double p99 = 0;
+	double desviacion = 0;
+	int repeticiones = 0;
+	long long lote = 1;
+	Lecturas contadores; // Media por ejecución de los contadores hardware (si se han pedido)
+};
+
+/*
+  Función que mide el tiempo de ejecución de f
+
+  Primero realiza el calentamiento, después calcula el tamaño del lote necesario para que cada muestra
+  dure al menos opciones.minimoMuestra, y por último toma las muestras y calcula sus estadísticas
+
+  Si se le pasan contadores, los activa solo mientras se toman las muestras y guarda su media por ejecución
+*/
+Estadisticas medir(std::function<void()> const &f, OpcionesMedicion const &opciones, Contadores *contadores = nullptr);
+
+#endif
@@ -0,0 +1,196 @@
+/*
+	Problema de las monedas
+
+	Interfaz común de todos los algoritmos
+
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
+	Universidad Complutense de Madrid
+
+	Beatriz Herguedas Pinedo
+*/
+
+#ifndef MONEDAS_H
+#define MONEDAS_H
+
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+/*
+  Resultado que devuelven todos los algoritmos a través de la interfaz común
+
+  - total, número mínimo de monedas encontrado (INT_MAX si no hay solución)
+  - cuantas, cuántas monedas del tipo M[i] hemos utilizado (vacío si el algoritmo no reconstruye la solución)
+  - nodos, número de nodos explorados (solo tiene sentido en los algoritmos de búsqueda)
+*/
+struct Resultado {
+	int total = INT_MAX;
+	std::vector<int> cuantas;
+	long long nodos = 0;
+};
+
+/*
+  Firma común de todos los algoritmos
+
+  Recibe como parámetros:
+  M, que es el vector que contiene los tipos de monedas, ordenado crecientemente y sin repetidos
+  C, que es la cantidad que queremos alcanzar
+*/
+using Resolutor = Resultado (*)(std::vector<int> const &M, int C);
+
+/*
+  Memoria de trabajo que los algoritmos reutilizan de una llamada a otra
+
+  Cada ranura es un bloque que solo crece, así que, una vez que ha alcanzado el tamaño del problema más
+  grande, las siguientes llamadas no piden memoria. Un Espacio no se puede usar desde varios hilos a la vez
+*/
+class Espacio {
+public:
+	/*
+	  Devuelve el bloque de la ranura con sitio para al menos n elementos de tipo T
+
+	  Si el bloque tiene que crecer conserva su contenido, pero los punteros anteriores a él dejan de valer
+	*/
+	template <typename T>
+	T *pedir(std::size_t n, int ranura = 0) {
+		if ((int)bloques.size() <= ranura)
+			bloques.resize(ranura + 1);
+		std::vector<unsigned char> &b = bloques[ranura];
+		if (b.size() < n * sizeof(T))
+			b.resize(n * sizeof(T));
+		return reinterpret_cast<T *>(b.data());
+	}
+
+private:
+	std::vector<std::vector<unsigned char>> bloques;
+};
+
+/*
+  Firma de las versiones sin reservas de memoria de los algoritmos
+
+  Recibe además:
+  espacio, que es la memoria de trabajo que se reutiliza entre llamadas
+  cuantas, donde se escribe cuántas monedas del tipo M[i] hemos utilizado (M.size() enteros, o nulo si no interesa)
+
+  Devuelve el número mínimo de monedas (INT_MAX si no hay solución). Cuando el espacio ya ha crecido hasta el
+  tamaño del problema, no piden memoria
+*/
+using ResolutorSinReservas = int (*)(std::vector<int> const &M, int C, Espacio &espacio, int *cuantas);
+
+// Firma de los algoritmos que admiten cantidades de 64 bits (el número de monedas tiene que seguir cabiendo en int)
+using ResolutorGrande = Resultado (*)(std::vector<int> const &M, long long C);
+
+/*
+  Descripción de cada algoritmo disponible
+
+  - nombre, con el que se elige desde la línea de órdenes y que da nombre a los ficheros de salida
+  - resolver, la función que lo ejecuta con la interfaz común
+  - exacto, si garantiza la solución óptima para cualquier sistema monetario
+  - itMin, itMax y suma, el intervalo de pruebas por defecto (los IT_MIN, IT_MAX y SUMA de cada fichero)
+  - resolverSinReservas, su versión sin reservas de memoria (nulo si no la tiene: los multihilo, porque crear
+    sus hilos ya pide memoria; VA, que no calcula el desglose, y Grandes, que en cada llamada construye para
+    las monedas la tabla de restos de CantidadesGrandes)
+  - multihilo, si crea sus propios hilos (el barrido de pruebas no lo ejecuta a la vez que otras pruebas)
+  - resolverGrande, su versión para cantidades de 64 bits (nulo si no la tiene)
+*/
+struct Algoritmo {
+	char const *nombre;
+	Resolutor resolver;
+	bool exacto;
+	int itMin;
+	int itMax;
+	int suma;
+	ResolutorSinReservas resolverSinReservas;
+	bool multihilo;
+	ResolutorGrande resolverGrande;
+};
+
+// Devuelve la lista de todos los algoritmos disponibles
+std::vector<Algoritmo> const &algoritmos();
+
+// Devuelve el algoritmo con ese nombre, o nullptr si no existe
+Algoritmo const *buscarAlgoritmo(std::string const &nombre);
+
+/////////////////////////////////////////////////////////////////////////////
+// Funciones originales de cada algoritmo
+
+// monedasVoraz1.cpp
+std::vector<int> monedasVoraz1(std::vector<int> const &M, int C, int &totalutilizadas, std::vector<std::pair<int, int>> &w);
+
+// monedasVoraz2.cpp
+std::vector<int> monedasVoraz2(std::vector<int> const &M, int C, int &totalutilizadas, std::vector<std::pair<int, int>> &w);
+
+// monedasPDVector.cpp (la versión sin plantilla elige el tipo de celda más estrecho posible)
+std::pair<int, std::vector<int>> monedasPDVector(std::vector<int> const &v, int C, int &totalutilizados);
+template <typename T>
+std::pair<int, std::vector<int>> monedasPDVector(std::vector<int> const &v, int C, int &totalutilizados);
+std::pair<int, std::vector<int>> monedasPDVectorParalelo(std::vector<int> const &v, int C, int &totalutilizados, int hilos);
+template <typename T>
+std::pair<int, std::vector<int>> monedasPDVectorParalelo(std::vector<int> const &v, int C, int &totalutilizados, int hilos);
+
+// monedasPDMatriz.cpp (la versión sin plantilla elige el tipo de celda más estrecho posible)
+std::pair<int, std::vector<int>> monedasPDMatriz(std::vector<int> const &v, int C, int &totalutilizados);
+template <typename T>
+std::pair<int, std::vector<int>> monedasPDMatriz(std::vector<int> const &v, int C, int &totalutilizados);
+
+// monedasPDLimitada.cpp (limites[i] es cuántas monedas del tipo v[i] tenemos; devuelve INT_MAX si no hay solución)
+// La versión con desglose usa memoria O(N * C); monedasPDLimitadaTotal solo da el número de monedas, con memoria O(C)
+std::pair<int, std::vector<int>> monedasPDLimitada(std::vector<int> const &v, std::vector<int> const &limites, int C,
+	int &totalutilizados);
+template <typename T>
+std::pair<int, std::vector<int>> monedasPDLimitada(std::vector<int> const &v, std::vector<int> const &limites, int C,
+	int &totalutilizados);
+int monedasPDLimitadaTotal(std::vector<int> const &v, std::vector<int> const &limites, int C);
+
+// monedasBFS.cpp (cuantas[i] es el número de monedas del tipo v[i])
+std::pair<int, std::vector<int>> monedasBFS(std::vector<int> const &v, int C, int &totalutilizados);
+
+// VASinPodas.cpp
+int vueltaAtras(int C, int tipo, int monedasUsadas, std::vector<int> const &M);
+int vueltaAtrasParalelo(int C, std::vector<int> const &M, int hilos, int niveles);
+
+// VAConPodas.cpp
+int vueltaAtrasPodada(std::vector<int> const &M, int C, std::vector<int> &cuantas, long long memoriaCache, long long &nodos);
+
+// RamificaciónYPoda.cpp (devuelven -1 si la cola pasa de maxNodos nodos; memoriaRPMinimo estima su memoria en bytes)
+int monedasRPMinimo(std::vector<int> const &M, int const &C, int N, std::vector<int> &solucion, int &numNodos,
+	long long maxNodos = LLONG_MAX);
+int monedasRPMinimoParalelo(std::vector<int> const &M, int const &C, int N, std::vector<int> &solucion, int &numNodos, int hilos,
+	long long maxNodos = LLONG_MAX);
+double memoriaRPMinimo(int N, int C, long long maxNodos, int hilos);
+
+/////////////////////////////////////////////////////////////////////////////
+// Adaptadores de cada algoritmo a la interfaz común
+
+Resultado resolverVoraz1(std::vector<int> const &M, int C);
+Resultado resolverVoraz2(std::vector<int> const &M, int C);
+Resultado resolverPDVector(std::vector<int> const &M, int C);
+Resultado resolverPDParalelo(std::vector<int> const &M, int C);
+Resultado resolverPDMatriz(std::vector<int> const &M, int C);
+Resultado resolverPDLimitada(std::vector<int> const &M, int C);
+Resultado resolverBFS(std::vector<int> const &M, int C);
+Resultado resolverVA(std::vector<int> const &M, int C);
+Resultado resolverVAParalelo(std::vector<int> const &M, int C);
+Resultado resolverVAPodas(std::vector<int> const &M, int C);
+Resultado resolverRYP(std::vector<int> const &M, int C);
+Resultado resolverRYPParalelo(std::vector<int> const &M, int C);
+Resultado resolverGrandes(std::vector<int> const &M, int C);
+Resultado resolverGrandes64(std::vector<int> const &M, long long C);
+
+/////////////////////////////////////////////////////////////////////////////
+// Versiones sin reservas de memoria
+
+int resolverVoraz1SinReservas(std::vector<int> const &M, int C, Espacio &espacio, int *cuantas);
+int resolverVoraz2SinReservas(std::vector<int> const &M, int C, Espacio &espacio, int *cuantas);
+int resolverPDVectorSinReservas(std::vector<int> const &M, int C, Espacio &espacio, int *cuantas);
+int resolverPDMatrizSinReservas(std::vector<int> const &M, int C, Espacio &espacio, int *cuantas);
+int resolverPDLimitadaSinReservas(std::vector<int> const &M, int C, Espacio &espacio, int *cuantas);
+int resolverBFSSinReservas(std::vector<int> const &M, int C, Espacio &espacio, int *cuantas);
+int resolverVAPodasSinReservas(std::vector<int> const &M, int C, Espacio &espacio, int *cuantas);
+int resolverRYPSinReservas(std::vector<int> const &M, int C, Espacio &espacio, int *cuantas);
+
+#endif
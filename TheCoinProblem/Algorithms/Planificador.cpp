@@ -0,0 +1,306 @@
+/*
+	Problema de las monedas
+
+	Planificador que elige automáticamente el algoritmo más rápido y seguro para cada entrada
+
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
+	Universidad Complutense de Madrid
+
+	Beatriz Herguedas Pinedo
+*/
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Canonico.h"
+#include "Celdas.h"
+#include "Planificador.h"
+
+using namespace std;
+
+// Número máximo de tipos de monedas para comprobar si el sistema es canónico (el método de Pearson es O(N^3))
+int const MAX_N_CANONICO = 400;
+
+// Número máximo de sistemas cuyo menor contraejemplo guardamos
+int const MAX_SISTEMAS_GUARDADOS = 64;
+
+// Número máximo de monedas de la solución para considerar la búsqueda en anchura (el límite de monedasBFS)
+int const MAX_NIVELES_BFS = 64;
+
+// Bytes de cada celda de la programación dinámica para la entrada
+static int bytesCelda(vector<int> const &M, int C) {
+	return segunCelda(cotaMonedas(M, C), [](auto celda) { return (int)sizeof(celda); });
+}
+
+/*
+  Función que devuelve el menor contraejemplo del sistema, guardando los de los últimos sistemas consultados
+  para no repetir la comprobación en cada consulta, aunque se alternen varios sistemas (por ejemplo desde los
+  hilos de un barrido)
+
+  Las consultas solo leen la tabla, así que varios hilos pueden consultarla a la vez, y la comprobación de
+  un sistema nuevo se hace sin tener el cerrojo. Si la tabla se llena, la vaciamos
+
+  Devuelve -1 si el sistema es demasiado grande para comprobarlo
+*/
+static long long contraejemploGuardado(vector<int> const &M) {
+	static shared_mutex m;
+	static map<vector<int>, long long> guardados;
+
+	if ((int)M.size() > MAX_N_CANONICO)
+		return -1;
+
+	{
+		shared_lock<shared_mutex> lectura(m);
+		auto it = guardados.find(M);
+		if (it != guardados.end())
+			return it->second;
+	}
+
+	long long contraejemplo = contraejemploMinimo(M);
+
+	lock_guard<shared_mutex> escritura(m);
+	if ((int)guardados.size() >= MAX_SISTEMAS_GUARDADOS)
+		guardados.clear();
+	guardados[M] = contraejemplo;
+	return contraejemplo;
+}
+
+Planificador::Planificador()
+	: memoriaMaxima(1e9), costeVoraz(2e-9), costePD(2.5e-10), costeMatriz(1.5e-9), costeBFS(1e-10) {}
+
+Plan Planificador::planificar(vector<int> const &M, int C, bool necesitaTabla) const {
+	Plan p;
+	int N = M.size();
+	int bytes = bytesCelda(M, C);
+
+	// Si se pide la tabla completa, solo nos vale la programación dinámica con matriz, si cabe en memoria
+	if (necesitaTabla) {
+		p.memoria = double(N + 1) * (C + 1.0) * bytes;
+		p.tiempo = costeMatriz * double(N) * C * bytes;
+		if (p.memoria > memoriaMaxima) {
+			p.motivo = "se pide la tabla completa y no cabe en memoria";
+			return p;
+		}
+		p.algoritmo = buscarAlgoritmo("PDMatriz");
+		p.motivo = "se pide la tabla completa";
+		return p;
+	}
+
+	// Método voraz, si es óptimo para esta cantidad
+	bool unidad = N > 0 && M[0] == 1;
+	long long contraejemplo = contraejemploGuardado(M);
+	if ((contraejemplo == 0 && unidad) || C < contraejemplo) {
+		p.algoritmo = buscarAlgoritmo("Voraz1");
+		p.memoria = 4.0 * N;
+		p.tiempo = costeVoraz * N;
+		p.motivo = contraejemplo == 0 ? "el sistema es canónico" : "C es menor que el menor contraejemplo";
+		return p;
+	}
+
+	// Programación dinámica con vector
+	p.algoritmo = buscarAlgoritmo("PDVector");
+	p.memoria = (C + 1.0) * bytes;
+	p.tiempo = costePD * double(N) * C * bytes;
+	p.motivo = "caso general";
+
+	// Búsqueda en anchura: estimamos el número de monedas de la solución entre la cota inferior C / (moneda mayor)
+	// y la solución del método voraz (si la encuentra)
+	if (N > 0 && C > 0) {
+		Resultado voraz = resolverVoraz1(M, C);
+		double cotaInferior = ((long long)C + M.back() - 1) / M.back();
+		double monedas = voraz.total != INT_MAX ? (cotaInferior + voraz.total) / 2 : 2 * cotaInferior + 1;
+		if (monedas <= MAX_NIVELES_BFS) {
+			double palabras = C / 64 + 1;
+			double tiempo = costeBFS * monedas * N * palabras;
+			double memoria = (monedas + 1) * palabras * 8;
+			if (tiempo < p.tiempo && memoria <= memoriaMaxima) {
+				p.algoritmo = buscarAlgoritmo("BFS");
+				p.tiempo = tiempo;
+				p.memoria = memoria;
+				p.motivo = "se esperan pocas monedas en la solución";
+			}
+		}
+	}
+
+	// Si la programación dinámica no cabe en memoria, usamos los restos módulo la moneda mayor, cuya memoria
+	// depende de las monedas y no de C (la tabla de cantidades pequeñas llega como mucho a m por la segunda moneda)
+	if (p.memoria > memoriaMaxima && N > 0) {
+		double m = M.back();
+		double segunda = N > 1 ? M[N - 2] : 0;
+		double memoria = 32 * m + 8 * m * segunda;
+		if (memoria <= memoriaMaxima) {
+			p.algoritmo = buscarAlgoritmo("Grandes");
+			p.memoria = memoria;
+			p.tiempo = costeMatriz * N * m * segunda;
+			p.motivo = "la programación dinámica no cabe en memoria y las monedas son pequeñas";
+			return p;
+		}
+	}
+
+	// Si tampoco, ramificación y poda (en paralelo si hay varios procesadores). Su cola no tiene límite,
+	// así que la acotamos a los nodos que caben en la memoria que dejan libre las tablas de dominancia
+	if (p.memoria > memoriaMaxima) {
+		int hilos = max(1u, thread::hardware_concurrency());
+		double tablas = memoriaRPMinimo(N, C, 0, hilos);
+		double porNodo = memoriaRPMinimo(N, C, 1, hilos) - tablas;
+		long long maxNodos = (long long)min<double>((memoriaMaxima - tablas) / porNodo, (double)LLONG_MAX);
+		p.tiempo = 0;
+		if (maxNodos < 1) {
+			p.algoritmo = nullptr;
+			p.memoria = tablas;
+			p.motivo = "ningún algoritmo cabe en memoria";
+			return p;
+		}
+		p.algoritmo = buscarAlgoritmo(hilos > 1 ? "RYPParalelo" : "RYP");
+		p.memoria = memoriaRPMinimo(N, C, maxNodos, hilos);
+		p.maxNodos = maxNodos;
+		p.motivo = "la programación dinámica no cabe en memoria";
+	}
+
+	return p;
+}
+
+Plan Planificador::planificarLimitada(vector<int> const &M, int C, bool conDesglose) const {
+	Plan p;
+	int N = M.size();
+	int bytes = bytesCelda(M, C);
+
+	// Mismo trabajo que la programación dinámica con vector, más la tabla del desglose si se pide
+	p.algoritmo = buscarAlgoritmo("PDLimitada");
+	p.tiempo = costePD * double(N) * C * bytes;
+	p.memoria = (C + 1.0) * bytes;
+	p.soloTotal = true;
+	p.motivo = "existencias limitadas, solo el número de monedas";
+	if (conDesglose) {
+		double desglose = p.memoria + double(N) * (C + 1.0) * bytes;
+		if (desglose <= memoriaMaxima) {
+			p.memoria = desglose;
+			p.soloTotal = false;
+			p.motivo = "existencias limitadas";
+		}
+		else
+			p.motivo = "existencias limitadas; la tabla del desglose no cabe en memoria";
+	}
+
+	if (p.memoria > memoriaMaxima) {
+		p.algoritmo = nullptr;
+		p.motivo = "existencias limitadas y no cabe en memoria";
+	}
+	return p;
+}
+
+Resultado Planificador::resolver(vector<int> const &M, int C) const {
+	Plan p = planificar(M, C);
+	if (p.algoritmo == nullptr)
+		throw length_error("Planificador: ningún algoritmo cabe en memoria");
+	if (p.maxNodos == 0)
+		return p.algoritmo->resolver(M, C);
+
+	// Ramificación y poda con la cola acotada
+	Resultado r;
+	int numNodos = 0;
+	int N = M.size();
+	int hilos = max(1u, thread::hardware_concurrency());
+	r.total = hilos > 1 ? monedasRPMinimoParalelo(M, C, N, r.cuantas, numNodos, hilos, p.maxNodos)
+		: monedasRPMinimo(M, C, N, r.cuantas, numNodos, p.maxNodos);
+	r.nodos = numNodos;
+	if (r.total == -1)
+		throw length_error("Planificador: la cola de la ramificación y poda no cabe en memoria");
+	return r;
+}
+
+/*
+  Para calibrar medimos cada algoritmo sobre una entrada representativa y dividimos la mediana del tiempo
+  entre el trabajo que le atribuye el modelo
+*/
+void Planificador::calibrar(OpcionesMedicion const &opciones) {
+
+	// Método voraz: sistema de potencias de 2 con 30 tipos
+	{
+		vector<int> M;
+		for (int i = 0; i < 30; ++i)
+			M.push_back(1 << i);
+		Estadisticas e = medir([&]() { resolverVoraz1(M, INT_MAX); }, opciones);
+		costeVoraz = e.mediana / M.size();
+	}
+
+	// Programación dinámica con vector y con matriz: 20 monedas no canónicas
+	{
+		vector<int> M = { 1 };
+		for (int i = 1; i < 20; ++i)
+			M.push_back(7 + 13 * i);
+		int C = 1000000;
+		Estadisticas e = medir([&]() { resolverPDVector(M, C); }, opciones);
+		costePD = e.mediana / (double(M.size()) * C * bytesCelda(M, C));
+
+		C = 100000;
+		e = medir([&]() { resolverPDMatriz(M, C); }, opciones);
+		costeMatriz = e.mediana / (double(M.size()) * C * bytesCelda(M, C));
+	}
+
+	// Búsqueda en anchura: monedas grandes para que la solución tenga pocas monedas
+	{
+		vector<int> M;
+		for (int i = 0; i < 20; ++i)
+			M.push_back(100003 + 7919 * i);
+		int C = 1000000;
+		Resultado r = resolverBFS(M, C);
+		Estadisticas e = medir([&]() { resolverBFS(M, C); }, opciones);
+		double niveles = max(1, r.total == INT_MAX ? MAX_NIVELES_BFS : r.total);
+		costeBFS = e.mediana / (niveles * M.size() * (C / 64 + 1));
+	}
+}
+
+bool Planificador::guardar(string const &fichero) const {
+	ofstream salida(fichero);
+	salida.precision(10);
+	salida << "voraz " << costeVoraz << '\n';
+	salida << "pd " << costePD << '\n';
+	salida << "matriz " << costeMatriz << '\n';
+	salida << "bfs " << costeBFS << '\n';
+	return bool(salida);
+}
+
+bool Planificador::cargar(string const &fichero) {
+	ifstream entrada(fichero);
+	if (!entrada)
+		return false;
+
+	string nombre;
+	double coste;
+	while (entrada >> nombre >> coste) {
+		if (nombre == "voraz")
+			costeVoraz = coste;
+		else if (nombre == "pd")
+			costePD = coste;
+		else if (nombre == "matriz")
+			costeMatriz = coste;
+		else if (nombre == "bfs")
+			costeBFS = coste;
+	}
+	return true;
+}
+
+Planificador &planificadorPorDefecto() {
+	static Planificador p = []() {
+		Planificador q;
+		q.cargar("Calibracion.txt");
+		return q;
+	}();
+	return p;
+}
+
+Resultado resolverAuto(vector<int> const &M, int C) {
+	return planificadorPorDefecto().resolver(M, C);
+}
@@ -0,0 +1,111 @@
+/*
+	Problema de las monedas
+
+	Planificador que elige automáticamente el algoritmo más rápido y seguro para cada entrada
+
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
+	Universidad Complutense de Madrid
+
+	Beatriz Herguedas Pinedo
+*/
+
+#ifndef PLANIFICADOR_H
+#define PLANIFICADOR_H
+
+#include <string>
+#include <vector>
+
+#include "Medicion.h"
+#include "Monedas.h"
+
+/*
+  Decisión del planificador para una entrada
+
+  - algoritmo, el algoritmo elegido (nullptr si ninguno cabe en memoria)
+  - tiempo, el tiempo estimado en segundos
+  - memoria, la memoria estimada en bytes
+  - motivo, por qué se ha elegido
+  - soloTotal, si solo se puede calcular el número de monedas y no el desglose (planificarLimitada)
+  - maxNodos, si no es 0, el máximo de nodos de la cola con el que hay que llamar a la ramificación y poda
+    para que quepa en memoria (resolver ya lo hace)
+*/
+struct Plan {
+	Algoritmo const *algoritmo = nullptr;
+	double tiempo = 0;
+	double memoria = 0;
+	std::string motivo;
+	bool soloTotal = false;
+	long long maxNodos = 0;
+};
+
+/*
+  Clase que estima el tiempo y la memoria de cada algoritmo para un sistema monetario y una cantidad,
+  y elige el más rápido de los que caben en memoria
+
+  - Si el sistema es canónico (o C es menor que su menor contraejemplo), el método voraz, en O(N)
+  - La búsqueda en anchura por bits si se espera una solución con pocas monedas
+  - La programación dinámica con vector en el resto de casos
+  - La programación dinámica con matriz solo si se pide la tabla completa (y ninguno si no cabe en memoria)
+  - Ramificación y poda si la programación dinámica no cabe en memoria, con la cola acotada a la memoria que queda
+  - Nunca la vuelta atrás sin podas, que es exponencial
+
+  El modelo de coste es lineal en el trabajo de cada algoritmo (N para el voraz, N * C para la programación
+  dinámica, solución * N * C / 64 para la búsqueda en anchura), y los coeficientes se pueden calibrar
+  midiendo cada algoritmo con el mismo medidor que usan las pruebas
+*/
+class Planificador {
+public:
+	Planificador();
+
+	/*
+	  Elige el algoritmo para la entrada
+
+	  Recibe como parámetros:
+	  M, que es el vector que contiene los tipos de monedas, ordenado crecientemente y sin repetidos
+	  C, que es la cantidad que queremos alcanzar
+	  necesitaTabla, si queremos la tabla completa de la programación dinámica con matriz
+	*/
+	Plan planificar(std::vector<int> const &M, int C, bool necesitaTabla = false) const;
+
+	/*
+	  Elige cómo resolver la entrada con existencias limitadas (monedasPDLimitada)
+
+	  Recibe como parámetros:
+	  M, que es el vector que contiene los tipos de monedas, ordenado crecientemente y sin repetidos
+	  C, que es la cantidad que queremos alcanzar
+	  conDesglose, si queremos cuántas monedas de cada tipo se usan
+
+	  El desglose necesita una tabla de N * (C + 1) celdas; si no cabe en memoria (o no se pide) el plan
+	  tiene soloTotal y se usa monedasPDLimitadaTotal, con C + 1 celdas. Si tampoco cabe, no hay algoritmo
+	*/
+	Plan planificarLimitada(std::vector<int> const &M, int C, bool conDesglose = true) const;
+
+	// Resuelve con el algoritmo elegido por planificar (lanza length_error si no cabe en memoria)
+	Resultado resolver(std::vector<int> const &M, int C) const;
+
+	// Mide cada algoritmo sobre entradas de prueba y ajusta los coeficientes del modelo de coste
+	void calibrar(OpcionesMedicion const &opciones);
+
+	// Guardan y cargan los coeficientes en un fichero de texto; cargar devuelve false si no se ha podido leer
+	bool guardar(std::string const &fichero) const;
+	bool cargar(std::string const &fichero);
+
+	// Memoria máxima en bytes que puede usar el algoritmo elegido (1 GB por defecto)
+	double memoriaMaxima;
+
+private:
+	// Segundos por unidad de trabajo de cada modelo
+	double costeVoraz;
+	double costePD;
+	double costeMatriz;
+	double costeBFS;
+};
+
+// Planificador compartido por el algoritmo "Auto": carga "Calibracion.txt" si existe
+Planificador &planificadorPorDefecto();
+
+// Adaptador del planificador a la interfaz común
+Resultado resolverAuto(std::vector<int> const &M, int C);
+
+#endif
@@ -0,0 +1,368 @@
+/*
+	Problema de las monedas
+
+	Programa de pruebas común a todos los algoritmos
+
+	Uso: monedas <algoritmo | todos> [potencias | multiplos | aleatorio | sinunidad] [IT_MIN IT_MAX SUMA] [opciones]
+
+	Opciones:
+	--semilla=S        semilla de 64 bits de las entradas (si no se indica se elige una y se muestra)
+	--corpus=F         lee las entradas del corpus binario F (si no existe, lo crea con todas las familias)
+	--cantidad=C       cantidad de 64 bits de todas las pruebas en vez de 2 * N (por encima de INT_MAX, solo Grandes)
+	--sinreservas      mide las versiones sin reservas de memoria (solo los algoritmos que las tienen)
+	--calentamiento=K  ejecuciones previas sin medir (2 por defecto)
+	--repeticiones=R   muestras por cada prueba (10 por defecto)
+	--muestra=S        duración mínima en segundos de cada muestra (0.001 por defecto)
+	--contadores       registra los contadores hardware de rendimiento (solo en Linux)
+	--hilos=H          reparte las pruebas entre H hilos, cada uno fijado a un procesador (1 por defecto)
+	--aislado          usa un núcleo físico por hilo, sin compartirlo con nada más, para no alterar los tiempos
+	--salida=F1,F2...  formatos de los resultados: texto, csv, json o binario (texto por defecto)
+	--calibrar         calibra el modelo de coste del algoritmo Auto y lo guarda en Calibracion.txt
+
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
+	Universidad Complutense de Madrid
+
+	Beatriz Herguedas Pinedo
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "Barrido.h"
+#include "Contadores.h"
+#include "Corpus.h"
+#include "Generador.h"
+#include "Medicion.h"
+#include "Monedas.h"
+#include "Planificador.h"
+#include "Resultados.h"
+
+using namespace std;
+
+/*
+  Función que realiza las pruebas de un algoritmo sobre una entrada ya generada
+
+  Recibe como parámetros:
+  a, que es el algoritmo que vamos a probar
+  k, la posición del algoritmo en la lista de algoritmos probados
+  N, que es el número total de tipos de monedas que tenemos
+  tiposMonedas, que es el vector con los tipos de monedas
+  C, que es la cantidad que queremos alcanzar (por encima de INT_MAX, solo si el algoritmo tiene resolverGrande)
+  sinReservas, si medimos la versión sin reservas de memoria del algoritmo (resolverSinReservas)
+  opciones, las opciones de la medición
+  contadores, los contadores hardware que registramos durante la medición (nullptr si no se han pedido)
+  r, donde guardamos el resultado para que el sumidero lo escriba en segundo plano
+*/
+void prueba(Algoritmo const &a, int k, int N, vector<int> const &tiposMonedas, long long C, bool sinReservas,
+	OpcionesMedicion const &opciones, Contadores *contadores, Registro &r) {
+
+	if (C > INT_MAX && (a.resolverGrande == nullptr || sinReservas))
+		throw invalid_argument("no admite cantidades mayores que INT_MAX");
+	if (sinReservas && a.resolverSinReservas == nullptr)
+		throw invalid_argument("no tiene versión sin reservas de memoria");
+	auto resolver = [&]() {
+		return C > INT_MAX ? a.resolverGrande(tiposMonedas, C) : a.resolver(tiposMonedas, (int)C);
+	};
+
+	// La versión sin reservas reutiliza el espacio y escribe el desglose en cuantas
+	Espacio espacio;
+	vector<int> cuantas(tiposMonedas.size());
+	auto resolverSinReservas = [&]() { return a.resolverSinReservas(tiposMonedas, (int)C, espacio, cuantas.data()); };
+
+	Resultado sol;
+	Estadisticas e;
+	if (sinReservas) {
+		// La primera llamada hace crecer el espacio hasta el tamaño del problema, así que las medidas no piden memoria
+		sol.total = resolverSinReservas();
+		sol.cuantas = cuantas;
+		e = medir([&]() { sol.total = resolverSinReservas(); }, opciones, contadores);
+	}
+	else {
+		// Realizamos la prueba llamando a la función que calcula la solución
+		sol = resolver();
+
+		// Medimos el tiempo repitiendo la llamada tantas veces como indiquen las opciones
+		e = medir([&]() { sol = resolver(); }, opciones, contadores);
+	}
+
+	// Guardamos el resultado
+	r.algoritmo = k;
+	r.N = N;
+	r.C = C;
+	r.total = sol.total;
+	// Si no hay solución no escribimos desglose (el método voraz deja en cuantas lo que ha intentado pagar)
+	for (size_t i = 0; sol.total != INT_MAX && i < sol.cuantas.size(); ++i) {
+		if (sol.cuantas[i] > 0)
+			r.usadas.push_back({ sol.cuantas[i], tiposMonedas[i] });
+	}
+	r.nodos = sol.nodos;
+	r.estadisticas = e;
+}
+
+/*
+  Función que escribe en los ficheros
+
+  Con el formato texto, para cada algoritmo probado:
+  - El fichero "Salida<nombre>" contiene la salida con toda la información
+  - El fichero "GraficaX<nombre>" contiene tan solo información de los tamaños de cara a pintar la gráfica
+  - El fichero "GraficaY<nombre>" contiene tan solo información de los tiempos (la mediana) de cara a pintar la gráfica
+  - El fichero "Estadisticas<nombre>" contiene para cada prueba el mínimo, la mediana, la media, el percentil 99
+    y la desviación típica de los tiempos, junto con el número de muestras y el tamaño del lote,
+    y si se han pedido, la media por ejecución de los contadores hardware
+
+  Con los formatos csv, json y binario se escriben los mismos datos de todos los algoritmos en un único
+  fichero Resultados.csv, Resultados.jsonl o Resultados.bin
+
+  Todos los algoritmos se prueban exactamente sobre las mismas entradas, que solo dependen de la semilla
+  del generador, la familia y N. Si se indica un corpus, las entradas se leen de él en vez de generarlas.
+  Si cantidad no es negativa, se usa como C en todas las pruebas. Con sinReservas se miden las versiones sin
+  reservas de memoria
+
+  Cada prueba (un algoritmo con un N) es independiente, así que el barrido las reparte entre sus hilos; los
+  resultados se escriben en el mismo orden que si se hicieran una detrás de otra
+
+  Cada entrada se genera (o se copia del corpus) una sola vez, la primera vez que la necesita alguna prueba, y
+  la comparten todos los algoritmos con ese N; se libera cuando la ha usado el último
+*/
+void fichero(vector<Algoritmo const *> const &lista, Generador const &generador, Corpus const *corpus, Familia familia,
+	int itMin, int itMax, int suma, long long cantidad, bool sinReservas, unsigned formatos, OpcionesMedicion const &opciones,
+	bool conContadores, OpcionesBarrido const &opcionesBarrido) {
+	uint64_t semilla = corpus != nullptr ? corpus->semilla() : generador.semilla();
+
+	// Elegimos los N del intervalo de iteraciones decidido, quitando los que no estén en el corpus
+	vector<int> valoresN;
+	vector<Instancia> instancias;
+	for (int i = itMin; i < itMax + 1; i = i + suma) {
+		Instancia instancia;
+		if (corpus != nullptr && !corpus->buscar(familia, i, instancia)) {
+			cerr << "El corpus no tiene la entrada " << nombreFamilia(familia) << " con N = " << i << '\n';
+			continue;
+		}
+		valoresN.push_back(i);
+		instancias.push_back(instancia);
+	}
+
+	// El barrido va antes que el sumidero para que, en el modo aislado, el hilo del sumidero herede su núcleo
+	Barrido barrido(opcionesBarrido);
+
+	// Creamos el sumidero, que abre los ficheros de cada formato y escribe en ellos desde su propio hilo
+	vector<string> nombres;
+	for (auto a : lista)
+		nombres.push_back(a->nombre);
+	Sumidero sumidero(nombres, formatos, semilla, nombreFamilia(familia), conContadores);
+
+	// La prueba j es la del algoritmo j % lista.size() con el N número j / lista.size()
+	int numAlgoritmos = (int)lista.size();
+
+	// Entrada de cada N, con las pruebas que todavía no la han usado
+	struct Entrada {
+		once_flag generada;
+		vector<int> tiposMonedas;
+		long long C = 0;
+		atomic<int> pendientes;
+	};
+	vector<Entrada> entradas(valoresN.size());
+	for (Entrada &e : entradas)
+		e.pendientes = numAlgoritmos;
+
+	auto tarea = [&](int j, OpcionesMedicion const &o, Contadores *contadores, Registro &r) {
+		int i = valoresN[j / numAlgoritmos];
+
+		// Generamos la entrada, que es la misma para todos los algoritmos
+		Entrada &e = entradas[j / numAlgoritmos];
+		call_once(e.generada, [&]() {
+			// Le damos un valor a C, que es la cantidad que queremos alcanzar para resolver el problema
+			// En este caso el valor elegido es 2 * N
+			e.C = 2 * i;
+
+			if (corpus == nullptr)
+				e.tiposMonedas = generador.monedas(familia, i);
+			else {
+				Instancia const &instancia = instancias[j / numAlgoritmos];
+				e.tiposMonedas = instancia.tipos();
+				e.C = instancia.C;
+			}
+			if (cantidad >= 0)
+				e.C = cantidad;
+		});
+
+		// Si el algoritmo falla (por ejemplo, no tiene memoria suficiente) saltamos la prueba y seguimos
+		bool correcta = true;
+		try {
+			prueba(*lista[j % numAlgoritmos], j % numAlgoritmos, i, e.tiposMonedas, e.C, sinReservas, o, contadores, r);
+		}
+		catch (exception const &ex) {
+			cerr << lista[j % numAlgoritmos]->nombre << " con N = " << i << ": " << ex.what() << '\n';
+			correcta = false;
+		}
+
+		// La última prueba con este N libera la entrada
+		if (--e.pendientes == 0)
+			vector<int>().swap(e.tiposMonedas);
+		return correcta;
+	};
+
+	// Los algoritmos que crean sus propios hilos no se ejecutan a la vez que las demás pruebas
+	auto multihilo = [&](int j) { return lista[j % numAlgoritmos]->multihilo; };
+	barrido.ejecutar((int)valoresN.size() * numAlgoritmos, opciones, conContadores, tarea, multihilo, sumidero);
+}
+
+int main(int argc, char *argv[]) {
+
+	// Separamos las opciones (las que empiezan por "--") de los argumentos posicionales
+	OpcionesMedicion opciones;
+	bool conContadores = false;
+	bool calibrar = false;
+	uint64_t semilla = Generador::semillaAleatoria();
+	string ficheroCorpus;
+	long long cantidad = -1;
+	bool sinReservas = false;
+	unsigned formatos = TEXTO;
+	OpcionesBarrido opcionesBarrido;
+	vector<char *> args;
+	for (int i = 0; i < argc; ++i) {
+		if (strncmp(argv[i], "--semilla=", 10) == 0)
+			semilla = strtoull(argv[i] + 10, nullptr, 0);
+		else if (strncmp(argv[i], "--corpus=", 9) == 0)
+			ficheroCorpus = argv[i] + 9;
+		else if (strncmp(argv[i], "--cantidad=", 11) == 0) {
+			cantidad = strtoll(argv[i] + 11, nullptr, 0);
+			if (cantidad < 0) {
+				cerr << "La cantidad no puede ser negativa: " << argv[i] + 11 << '\n';
+				return 1;
+			}
+		}
+		else if (strncmp(argv[i], "--calentamiento=", 16) == 0)
+			opciones.calentamiento = max(0, atoi(argv[i] + 16));
+		else if (strncmp(argv[i], "--repeticiones=", 15) == 0)
+			opciones.repeticiones = max(1, atoi(argv[i] + 15));
+		else if (strncmp(argv[i], "--muestra=", 10) == 0)
+			opciones.minimoMuestra = atof(argv[i] + 10);
+		else if (strncmp(argv[i], "--hilos=", 8) == 0)
+			opcionesBarrido.hilos = max(1, atoi(argv[i] + 8));
+		else if (strcmp(argv[i], "--aislado") == 0)
+			opcionesBarrido.aislado = true;
+		else if (strncmp(argv[i], "--salida=", 9) == 0) {
+			if (!leerFormatos(argv[i] + 9, formatos)) {
+				cerr << "Formato de salida desconocido: " << argv[i] + 9 << '\n';
+				return 1;
+			}
+		}
+		else if (strcmp(argv[i], "--sinreservas") == 0)
+			sinReservas = true;
+		else if (strcmp(argv[i], "--contadores") == 0)
+			conContadores = true;
+		else if (strcmp(argv[i], "--calibrar") == 0)
+			calibrar = true;
+		else if (strncmp(argv[i], "--", 2) == 0) {
+			cerr << "Opción desconocida: " << argv[i] << '\n';
+			return 1;
+		}
+		else
+			args.push_back(argv[i]);
+	}
+	argc = (int)args.size();
+	argv = args.data();
+
+	if (argc < 2) {
+		cerr << "Uso: " << argv[0] << " <algoritmo | todos> [potencias | multiplos | aleatorio | sinunidad] [IT_MIN IT_MAX SUMA]"
+			" [--semilla=S] [--corpus=F] [--cantidad=C] [--sinreservas] [--calentamiento=K] [--repeticiones=R] [--muestra=S] [--contadores]"
+			" [--hilos=H] [--aislado] [--salida=F1,F2...] [--calibrar]\n";
+		cerr << "Algoritmos:";
+		for (auto const &a : algoritmos())
+			cerr << ' ' << a.nombre;
+		cerr << '\n';
+		return 1;
+	}
+
+	// Elegimos los algoritmos a probar
+	vector<Algoritmo const *> lista;
+	string nombre = argv[1];
+	if (nombre == "todos") {
+		for (auto const &a : algoritmos()) {
+			if (!sinReservas || a.resolverSinReservas != nullptr)
+				lista.push_back(&a);
+		}
+	}
+	else if (Algoritmo const *a = buscarAlgoritmo(nombre)) {
+		if (sinReservas && a->resolverSinReservas == nullptr) {
+			cerr << nombre << " no tiene versión sin reservas de memoria\n";
+			return 1;
+		}
+		lista.push_back(a);
+	}
+	else {
+		cerr << "Algoritmo desconocido: " << nombre << '\n';
+		return 1;
+	}
+
+	// Familia de sistemas monetarios
+	Familia familia = ALEATORIO;
+	if (argc > 2 && !buscarFamilia(argv[2], familia)) {
+		cerr << "Familia desconocida: " << argv[2] << '\n';
+		return 1;
+	}
+
+	// Intervalo de pruebas: el indicado, el del algoritmo elegido o uno pequeño si los probamos todos
+	int itMin = 10, itMax = 15, suma = 1;
+	if (lista.size() == 1) {
+		itMin = lista[0]->itMin;
+		itMax = lista[0]->itMax;
+		suma = lista[0]->suma;
+	}
+	if (argc > 5) {
+		itMin = atoi(argv[3]);
+		itMax = atoi(argv[4]);
+		suma = max(1, atoi(argv[5]));
+	}
+
+	// Mostramos la semilla para poder repetir exactamente las mismas pruebas con --semilla
+	Generador generador(semilla);
+
+	// Abrimos el corpus, creándolo antes con todas las familias y el intervalo de pruebas si no existe
+	unique_ptr<Corpus> corpus;
+	if (!ficheroCorpus.empty()) {
+		try {
+			if (!ifstream(ficheroCorpus)) {
+				vector<int> numTipos;
+				for (int i = itMin; i < itMax + 1; i = i + suma)
+					numTipos.push_back(i);
+				Corpus::escribir(ficheroCorpus, generador, { POTENCIAS, MULTIPLOS, ALEATORIO, SINUNIDAD }, numTipos);
+			}
+			corpus.reset(new Corpus(ficheroCorpus));
+		}
+		catch (exception const &e) {
+			cerr << e.what() << '\n';
+			return 1;
+		}
+		semilla = corpus->semilla();
+	}
+	cout << "Semilla = " << semilla << '\n';
+
+	// Calibramos el planificador con las mismas opciones de medición que las pruebas
+	if (calibrar) {
+		planificadorPorDefecto().calibrar(opciones);
+		planificadorPorDefecto().guardar("Calibracion.txt");
+	}
+
+	// Comprobamos si se pueden abrir los contadores hardware (cada hilo del barrido abre después los suyos)
+	if (conContadores && !Contadores().disponible())
+		cerr << "Aviso: no se han podido abrir los contadores hardware (perf_event_paranoid)\n";
+
+	fichero(lista, generador, corpus.get(), familia, itMin, itMax, suma, cantidad, sinReservas, formatos, opciones,
+		conContadores, opcionesBarrido);
+	return 0;
+}
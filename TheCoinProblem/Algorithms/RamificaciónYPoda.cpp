@@ -1,280 +1,465 @@
 /*
 	Problema de las monedas
 
-	Implementacin con mtodo de ramificacin y poda (esquema pesimista-optimista)
+	Implementación con método de ramificación y poda (esquema pesimista-optimista)
 
-	Mtodos algortmicos en Resolucin de Problemas
-	Facultad de Informtica
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
 	Universidad Complutense de Madrid
 
 	Beatriz Herguedas Pinedo
 */
 
 #include <algorithm>
+#include <atomic>
 #include <climits>
-#include <cmath>
-#include <ctime>
-#include <fstream>
-#include <iomanip>
-#include <iostream>
-#include <math.h>
-#include <queue>
-#include <stdio.h>
-#include <stdlib.h> 
-#include <time.h>
-#include <unordered_map>
+#include <mutex>
+#include <numeric>
+#include <thread>
 #include <vector>
 
-using namespace std;
+#include "Monedas.h"
 
-// Constantes que indican el intervalo del nmero de iteraciones del bucle
-int const IT_MIN = 10;
-int const IT_MAX = 15;
+using namespace std;
 
-// De cunto en cunto se va iterando el bucle
-int const SUMA = 1;
+/*
+  Los nodos no guardan su solución parcial: la búsqueda solo calcula el número mínimo de monedas, y el desglose
+  se busca al final con buscarDesglose, igual en la versión secuencial que en la paralela, así que las dos
+  devuelven siempre la misma solución
 
-// Constantes que indican el intervalo en el que queremos que se mueva el random
-int const RA_MIN = 1;
-int const RA_MAX = 2;
+  Así las entradas de la cola son de tamaño fijo y trivialmente copiables, y ni el almacén ni la cola piden
+  memoria por nodo (se reutilizan entre llamadas del mismo hilo)
+*/
 
-// Nodo con toda la informacin necesaria
+// Nodo con toda la información necesaria
 struct nodo {
-	vector<int> sol; // Array de soluciones parciales
-	int k;  // Indica el nivel del rbol explorado
+	int costeEstimado; // Cantidad estimada, cota optimista, de coste del nodo como solución (prioridad)
+	int k;  // Indica el nivel del árbol explorado
 	int cantidad; // Indica la cantidad pagada hasta el momento
 	int monedas; // Recuento de monedas utilizadas hasta el momento
-	int costeEstimado; // Cantidad estimada, cota optimista, de coste del nodo como solucin (prioridad)
 };
 
-// Comparador para la cola
+// Comparador para la cola (a igual coste estimado, primero los nodos más profundos y luego los que más han pagado)
 class comparador {
 public:
-	bool operator()(nodo& n1, nodo& n2) {
-		return n1.costeEstimado > n2.costeEstimado;
+	bool operator()(nodo const& n1, nodo const& n2) const {
+		if (n1.costeEstimado != n2.costeEstimado)
+			return n1.costeEstimado > n2.costeEstimado;
+		if (n1.k != n2.k)
+			return n1.k > n2.k;
+		return n1.cantidad < n2.cantidad;
 	}
 };
 
 /*
-	Funcin que calcula la cota optimista para una cantidad acumulada dada la cantidad total a cubrir
-	Recibe como parmetros:
-	cantidadTotal, cantidad total a pagar para resolver el problema del cambio
-	cantidadAcumulada, cantidad que ya se ha pagado
-	monedas, nmero de monedas ya usado
-*/
-int calculo_pesimista(int cantidadTotal, int cantidadAcumulada, int monedas) {
-	// assert(cantidadTotal >= cantidadRestante);
-	return (cantidadTotal - cantidadAcumulada) + monedas;
-}
+  Tabla de dominancia: para cada estado (k, cantidad), el menor número de monedas con el que un nodo ha llegado
+  a él. Un nodo que llega a un estado ya visto con las mismas o más monedas no puede mejorar lo que encuentre el
+  primero, así que se descarta
 
-/*
-	Funcin que calcula la cota optimista para una cantidad acumulada dada la cantidad total a cubrir
-	Recibe como parmetros:
-	cantidadTotal, cantidad total a pagar para resolver el problema del cambio
-	cantidadAcumulada, cantidad que ya se ha pagado
-	monedas, nmero de monedas ya usado
-	monedaMax, valor de la moneda de mayor valor en el sistema
+  Es una tabla de acceso directo por dispersión, de tamaño acotado: si dos estados caen en la misma posición el
+  último sustituye al anterior, con lo que solo se pierden podas, nunca soluciones
 */
-int calculo_optimista(int cantidadTotal, int cantidadAcumulada, int monedas, int monedaMax) {
-	return ((cantidadTotal - cantidadAcumulada) / monedaMax) + monedas;
-}
+struct estado {
+	long long clave; // k * (C + 1) + cantidad
+	int monedas;
+	unsigned llamada; // Llamada que escribió la posición (las de llamadas anteriores cuentan como vacías)
+};
 
-/*
-  Funcin que resuelve el problema de las monedas con el mtodo de ramificacin y poda
+// Máximo número de posiciones de la tabla de dominancia
+size_t const MAX_ESTADOS = size_t(1) << 20;
 
-  Recibe como parmetros:
-  M, que es el vector que contiene los tipos de monedas
-  C, que es la cantidad que queremos alcanzar
-  N, que es el nmero de tipos de monedas que tenemos
-  solucion, que es el array de soluciones parciales
-  numNodos, que es el nmero de nodos explorados
-
-  Devuelve el mnimo nmero de monedas necesario para alcanzar la cantidad C
+// Almacén con la cola de prioridad (un montículo sobre un vector) y la tabla de dominancia, reutilizados entre llamadas
+struct almacen {
+	vector<nodo> cola;
+	vector<estado> estados;
+	vector<int> divisor;
+	unsigned llamada = 0;
+};
 
-  La poda consiste en descartar la solucin que llevamos si esta es peor que una ya encontrada
-*/
-int monedasRPMinimo(vector<int> const& M, int const & C, int N, vector<int>& solucion, int& numNodos) {
-	// Coste mejor, al principio es tomar C monedas unidad
-	int coste_mejor = C;
-	// Generamos la raz
-	nodo Y,X; Y.k = N; Y.cantidad = 0; Y.monedas = 0; Y.sol.resize(N, 0);
-	Y.costeEstimado = calculo_optimista(C, Y.cantidad, Y.monedas, M[Y.k-1]);
-	// Creamos la cola
-	priority_queue<nodo, vector<nodo>, comparador> cola;
-	cola.push(Y); numNodos = 0;
-	while (!cola.empty() && cola.top().costeEstimado <= coste_mejor) {
-		numNodos = max( (int)cola.size(), numNodos);
-		Y = cola.top(); cola.pop();
-		X.k = Y.k - 1; X.sol = Y.sol; // pasamos a considerar el siguiente tipo de moneda
-		X.cantidad = Y.cantidad; X.monedas = Y.monedas;
-		if (X.k < 0) continue;
-		X.costeEstimado = calculo_optimista(C, X.cantidad, X.monedas, M[X.k]);
-		// Para cada nivel probamos a usar desde cero monedas hasta el mximo posible
-		// No tomamos monedas de ese tipo
-		if(X.k > 0 && X.costeEstimado <= coste_mejor)
-			cola.push(X);
-		
-		// Consideramos tomar monedas de ese tipo
-		for (int i = 0; i < (C-X.cantidad)/ M[X.k]; i++) {
-			X.sol[X.k] += 1;
-			X.cantidad += M[X.k];
-			X.monedas += 1;
-			X.costeEstimado = calculo_optimista(C, X.cantidad, X.monedas, M[X.k]);
-			if (X.costeEstimado <= coste_mejor) {
-				if (X.cantidad == C) {
-					coste_mejor = X.monedas;
-					solucion = X.sol;
-				}
-				else {
-					int pes = calculo_pesimista(C, X.cantidad, X.monedas);
-					coste_mejor = min(pes, coste_mejor);
-					cola.push(X);
-				}
-			}
-		}
-		
+// Deja el almacén vacío y con una tabla de dominancia de hasta numEstados posiciones
+static void preparar(almacen& a, long long numEstados) {
+	a.cola.clear();
+	size_t tam = 1;
+	while (tam < MAX_ESTADOS && (long long)tam < numEstados)
+		tam *= 2;
+	// Así no hay que vaciar la tabla en cada llamada, solo cuando crece o el contador da la vuelta
+	if (++a.llamada == 0 || a.estados.size() < tam) {
+		a.estados.assign(max(tam, a.estados.size()), estado{ 0, 0, 0 });
+		a.llamada = 1;
 	}
-
-	return coste_mejor;
 }
 
+static almacen& almacenDelHilo(long long numEstados) {
+	thread_local almacen a;
+	preparar(a, numEstados);
+	return a;
+}
 
 /*
-  Funcin que realiza las pruebas
+  Función que consulta y actualiza la tabla de dominancia
 
-  Recibe como parmetros:
-  N, que es el nmero total de tipos de monedas que tenemos
-  salida, flujo de salida para escribir por fichero toda la informacin necesaria sobre la prueba
-  salidaGraficaX, flujo de salida para escribir por fichero la informacin sobre el tamao de la prueba
-  salidaGraficaY, flujo de salida para escribir por fichero la informacin sobre el tiempo que ha durado la prueba
+  Devuelve true si ya se había llegado al estado (k, cantidad) con monedas o menos, y si no lo apunta
 */
-void prueba(int const N, ofstream & salida, ofstream & salidaGraficarX, ofstream & salidaGraficarY) {
-
-	// Generamos la semilla del random en funcin del tiempo
-	srand(time(NULL));
+static bool dominado(almacen& a, long long clave, int monedas) {
+	estado& e = a.estados[(size_t)(clave * 0x9E3779B97F4A7C15ULL >> 20) & (a.estados.size() - 1)];
+	if (e.llamada == a.llamada && e.clave == clave && e.monedas <= monedas)
+		return true;
+	e.clave = clave;
+	e.monedas = monedas;
+	e.llamada = a.llamada;
+	return false;
+}
 
-	// Creamos nuestra moneda
-	int valorMoneda;
+/*
+	Función que calcula la cota pesimista completando la cantidad con el método voraz
+	Recibe como parámetros:
+	M, que es el vector que contiene los tipos de monedas
+	k, de forma que solo quedan por decidir los tipos de monedas 0..k-1
+	restante, cantidad que queda por pagar
+	monedas, número de monedas ya usado
+
+	Devuelve INT_MAX si el método voraz no consigue completar la cantidad
+*/
+static int calculo_pesimista(vector<int> const& M, int k, int restante, int monedas) {
+	for (int i = k - 1; i >= 0 && restante > 0; --i) {
+		int n = restante / M[i];
+		restante -= n * M[i];
+		monedas += n;
+	}
+	return restante == 0 ? monedas : INT_MAX;
+}
 
-	// Creamos el vector que va a almacenar los tipos de monedas
-	// int* tiposMonedas = new int[N];
-	vector<int> tiposMonedas(N, 0);
+/*
+	Función que calcula la cota optimista relajando el problema a uno lineal, en el que se pueden tomar
+	fracciones de moneda: lo mejor es pagar todo lo que queda con la moneda mayor de las que quedan, y como el
+	número de monedas es entero redondeamos hacia arriba
+	Recibe como parámetros:
+	restante, cantidad que queda por pagar
+	monedas, número de monedas ya usado
+	monedaMax, valor de la moneda de mayor valor de las que quedan por decidir
+	divisor, máximo común divisor de las monedas que quedan por decidir
+
+	Devuelve INT_MAX si lo que queda no es múltiplo del máximo común divisor, porque entonces no se puede pagar
+*/
+static int calculo_optimista(int restante, int monedas, int monedaMax, int divisor) {
+	if (restante % divisor != 0)
+		return INT_MAX;
+	// Redondeamos hacia arriba sin sumar monedaMax a restante, que podría desbordarse
+	return restante == 0 ? monedas : monedas + (restante - 1) / monedaMax + 1;
+}
 
-	// Aadimos la moneda unidad
-	tiposMonedas[0] = 1;
+// Calcula divisor, donde divisor[k] es el máximo común divisor de las monedas M[0..k-1]
+static void divisores(vector<int> const& M, vector<int>& divisor) {
+	divisor.assign(M.size() + 1, 0);
+	for (size_t k = 1; k <= M.size(); ++k)
+		divisor[k] = gcd(divisor[k - 1], M[k - 1]);
+}
 
-	// Recorremos el vector insertando los tipos de monedas
-	for (int i = 1; i < N; ++i) {
+// Genera la raíz del árbol de búsqueda (nivel N, nada pagado)
+static nodo raiz(vector<int> const& M, int C, vector<int> const& divisor) {
+	nodo Y;
+	Y.k = (int)M.size(); Y.cantidad = 0; Y.monedas = 0;
+	Y.costeEstimado = calculo_optimista(C, 0, M.back(), divisor[M.size()]);
+	return Y;
+}
 
+/*
+  Función que expande el nodo Y: genera sus hijos, que toman desde el máximo posible de monedas del tipo
+  Y.k - 1 hasta cero, y mete en la cola de a los que no se pueden podar
 
-		// Le damos un valor aleatorio (entre 1 y 4 * N) a la moneda que vamos a insertar
-		// Cuando ya sabemos seguro que la moneda no est entre las que tenamos, la insertamos
-		// en el vector que almacena los tipos de moneda
-		bool found = false;
-		while (!found) {
-			valorMoneda = 1 + rand() % (4 * N);
-			found = true;
-			for (int j = 0; j <= i && found; j++) {
-				found = valorMoneda != tiposMonedas[j];
-			}
+  Recibe como parámetros, además del problema y el nodo:
+  a, almacén con la cola y la tabla de dominancia
+  cota, función que devuelve el coste de la mejor solución encontrada
+  mejorar, función a la que se llama con el coste de cada solución mejor que se encuentra
+*/
+template <typename Cota, typename Mejora>
+static void expandir(vector<int> const& M, int C, vector<int> const& divisor, nodo const& Y, almacen& a, Cota cota, Mejora mejorar) {
+	comparador comp;
+	nodo X;
+	X.k = Y.k - 1; // pasamos a considerar el siguiente tipo de moneda
+	int moneda = M[X.k];
+
+	for (int i = (C - Y.cantidad) / moneda; i >= 0; i--) {
+		X.cantidad = Y.cantidad + i * moneda;
+		X.monedas = Y.monedas + i;
+		int restante = C - X.cantidad;
+		if (restante != 0) {
+			// En el último nivel no quedan monedas con las que completar la cantidad
+			if (X.k == 0)
+				continue;
+			X.costeEstimado = calculo_optimista(restante, X.monedas, M[X.k - 1], divisor[X.k]);
+			if (X.costeEstimado >= cota())
+				continue;
+			if (dominado(a, (long long)X.k * (C + 1LL) + X.cantidad, X.monedas))
+				continue;
+		}
+		else if (X.monedas >= cota())
+			continue;
+
+		int pes = calculo_pesimista(M, X.k, restante, X.monedas);
+		if (pes < cota())
+			mejorar(pes);
+		if (restante != 0 && X.costeEstimado < cota()) {
+			a.cola.push_back(X);
+			push_heap(a.cola.begin(), a.cola.end(), comp);
 		}
-		
-		tiposMonedas[i] = valorMoneda;
 	}
+}
 
-	sort(tiposMonedas.begin(), tiposMonedas.end());
+/*
+  Función que estima la memoria en bytes de la ramificación y poda con hilos hilos si la cola llega a maxNodos
+  nodos: las tablas de dominancia (la de cada hilo y la del hilo que llama) y, por cada nodo, su entrada en la
+  cola, contando con que los vectores pueden tener reservado el doble de lo que usan
+*/
+double memoriaRPMinimo(int N, int C, long long maxNodos, int hilos) {
+	hilos = max(1, hilos);
+	double estados = min<double>(double(N) * (C + 1.0), MAX_ESTADOS);
+	double tablas = estados * sizeof(estado) * (hilos > 1 ? 2 : 1);
+	return tablas + 2.0 * sizeof(nodo) * maxNodos;
+}
 
+/*
+  Función que busca el desglose con objetivo monedas que, mirando desde la moneda mayor, toma más monedas de
+  cada tipo (el mayor en orden lexicográfico). Sirve para que las dos versiones devuelvan siempre la misma
+  solución, sea cual sea el orden en que se encuentren las soluciones óptimas
 
+  Es una búsqueda en profundidad que prueba primero el mayor número de monedas de cada tipo y poda con la cota
+  optimista y con la tabla de dominancia: si ya se llegó a un estado con las mismas o menos monedas y no se
+  encontró solución, con más monedas tampoco se encontrará
+*/
+static bool buscarDesglose(vector<int> const& M, int C, vector<int> const& divisor, almacen& a, int k, int cantidad, int monedas, int objetivo, int* solucion) {
+	int restante = C - cantidad;
+	if (restante == 0)
+		return monedas == objetivo;
+	if (k == 0 || calculo_optimista(restante, monedas, M[k - 1], divisor[k]) > objetivo)
+		return false;
+	if (dominado(a, (long long)k * (C + 1LL) + cantidad, monedas))
+		return false;
+	int moneda = M[k - 1];
+	for (int i = restante / moneda; i >= 0; --i) {
+		solucion[k - 1] = i;
+		if (buscarDesglose(M, C, divisor, a, k - 1, cantidad + i * moneda, monedas + i, objetivo, solucion))
+			return true;
+	}
+	solucion[k - 1] = 0;
+	return false;
+}
 
-	// Le damos un valor a C, que es la cantidad que queremos alcanzar para resolver el problema
-	// En este caso el valor elegido es 2 * N
-	int C = 2 * N;
+/*
+  Función que hace el cálculo de monedasRPMinimo escribiendo la solución en solucion[0..N-1]
 
-	int numNodos = 0;
-	// int* solucion = new int[N];
-	vector<int> solucion(N + 1);
+  El almacén del hilo guarda la cola, la tabla de dominancia y los divisores, así que en las llamadas en las
+  que no crecen no se pide memoria. Si la cola pasa de maxNodos, devuelve -1
+*/
+static int ramificacionYPoda(vector<int> const& M, int C, int N, int* solucion, int& numNodos, long long maxNodos = LLONG_MAX) {
+	almacen& a = almacenDelHilo((long long)N * (C + 1LL));
+	comparador comp;
+	fill(solucion, solucion + N, 0);
+	numNodos = 0;
+	if (C == 0)
+		return 0;
+	if (N == 0)
+		return INT_MAX;
+	vector<int>& divisor = a.divisor;
+	divisores(M, divisor);
+
+	// Coste mejor, al principio el del método voraz con todas las monedas
+	int coste_mejor = calculo_pesimista(M, N, C, 0);
+
+	// Generamos la raíz
+	a.cola.push_back(raiz(M, C, divisor));
+	while (!a.cola.empty() && a.cola.front().costeEstimado < coste_mejor) {
+		pop_heap(a.cola.begin(), a.cola.end(), comp);
+		nodo Y = a.cola.back(); a.cola.pop_back();
+		++numNodos;
+		expandir(M, C, divisor, Y, a,
+			[&]() { return coste_mejor; },
+			[&](int coste) { coste_mejor = coste; });
+		if ((long long)a.cola.size() > maxNodos)
+			return -1;
+	}
 
-	// Inicializamos el nmero total de monedas utilizadas a 0
-	int totalutilizadas = 0;
+	if (coste_mejor != INT_MAX) {
+		preparar(a, (long long)N * (C + 1LL));
+		buscarDesglose(M, C, divisor, a, N, 0, 0, coste_mejor, solucion);
+	}
+	return coste_mejor;
+}
 
-	// Nos guardamos el tiempo justo antes de realizar la prueba
-	int t0 = clock();
+/*
+  Función que resuelve el problema de las monedas con el método de ramificación y poda
 
-	// Realizamos la prueba llamando a la funcin que calcula la solucin y guardndola en el par sol
-	int sol = monedasRPMinimo(tiposMonedas, C, N, solucion, numNodos);
-	totalutilizadas = sol;
-	// Nos guardamos el tiempo justo al terminar la prueba
-	int t1 = clock();
+  Recibe como parámetros:
+  M, que es el vector que contiene los tipos de monedas
+  C, que es la cantidad que queremos alcanzar
+  N, que es el número de tipos de monedas que tenemos
+  solucion, que es el array de soluciones parciales
+  numNodos, que es el número de nodos explorados
 
-	// Calculamos el tiempo que ha durado la prueba restando el inicial al final
-	double tiempo = double(t1 - t0) / CLOCKS_PER_SEC;
+  Devuelve el mínimo número de monedas necesario para alcanzar la cantidad C (INT_MAX si no se puede)
 
-	/////////////////////////////////////////////////////////////////////////////
-	// Ahora escribimos en los archivos
+  Un nodo de nivel k ya ha decidido cuántas monedas toma de los tipos k..N-1. La poda consiste en descartar los
+  nodos cuya cota optimista no mejora la mejor solución encontrada y los dominados por otro nodo que llegó al
+  mismo (k, cantidad) con menos monedas. La cota pesimista completa la cantidad con el método voraz, y como es
+  una solución de verdad, cuando mejora a la mejor nos quedamos con su coste. Al terminar, el desglose se busca
+  con buscarDesglose, así que es el mismo que el de monedasRPMinimoParalelo
 
-	// Primero en salida
-	salida << "Nmero de tipos de monedas que tenemos: " << N << '\n';
-	salida << "Queremos alcanzar la cantidad " << C << '\n';
-	salida << "Cantidad total de monedas utilizadas: " << totalutilizadas << '\n';
+  La cola no tiene más límite que el número de estados, así que con maxNodos se acota su memoria
+  (memoriaRPMinimo): si la cola llega a más de maxNodos nodos se abandona la búsqueda y se devuelve -1
+*/
+int monedasRPMinimo(vector<int> const& M, int const & C, int N, vector<int>& solucion, int& numNodos, long long maxNodos) {
+	solucion.assign(N, 0);
+	return ramificacionYPoda(M, C, N, solucion.data(), numNodos, maxNodos);
+}
 
-	/*salida << "Hemos cogido ";
-	for (int i = 0; i < N; i++) {
-		if (solucion[i] > 0)
-			salida << solucion[i] << " monedas del tipo " << tiposMonedas[i - 1] << '\n';
-	}*/
+/*
+  Cola de cada hilo, protegida por un cerrojo para que los demás hilos puedan robarle nodos, y su almacén, que
+  solo usa él: la tabla de dominancia y, en a.cola, los hijos del nodo que está expandiendo
+*/
+struct trabajador {
+	mutex cerrojo;
+	vector<nodo> cola;
+	almacen a;
+};
 
-	salida << "Tiempo requerido = " << tiempo << " segundos" << '\n';
-	salida << "--------------------------\n";
+/*
+  Versión paralela de monedasRPMinimo con hilos hilos
 
-	// Despus en grficaX
-	salidaGraficarX << N << '\n';
+  Cada hilo tiene su propia cola de prioridad y su tabla de dominancia. Cuando su cola se vacía roba el mejor
+  nodo de la cola de otro hilo. El cerrojo de la cola solo se coge para sacar el nodo y para meter sus hijos,
+  no mientras se expande, así que los demás hilos pueden robarle nodos mientras tanto. El coste de la mejor
+  solución se comparte en una variable atómica, así que todos los hilos podan con la mejor cota encontrada por
+  cualquiera de ellos
 
-	// Y por ltimo en grficaY
-	salidaGraficarY << fixed;
-	salidaGraficarY << setprecision(3) << tiempo << '\n';
+  El número de monedas es siempre el óptimo, y el desglose se calcula al final con buscarDesglose para que no
+  dependa del reparto entre hilos. numNodos sí puede variar de una ejecución a otra
 
-	/////////////////////////////////////////////////////////////////////////////
+  Como en monedasRPMinimo, si entre todas las colas hay más de maxNodos nodos se abandona y se devuelve -1
+*/
+int monedasRPMinimoParalelo(vector<int> const& M, int const & C, int N, vector<int>& solucion, int& numNodos, int hilos, long long maxNodos) {
+	solucion.assign(N, 0);
+	numNodos = 0;
+	if (C == 0)
+		return 0;
+	if (N == 0)
+		return INT_MAX;
+	hilos = max(1, hilos);
+	vector<int> divisor;
+	divisores(M, divisor);
+
+	atomic<int> coste_mejor(calculo_pesimista(M, N, C, 0));
+	// Nodos en alguna cola o expandiéndose: cuando llega a cero no queda trabajo
+	atomic<long long> pendientes(1);
+	atomic<long long> nodos(0);
+	atomic<bool> agotado(false);
+
+	vector<trabajador> trabajadores(hilos);
+	long long numEstados = max<long long>(1, min<long long>((long long)N * (C + 1LL), MAX_ESTADOS / hilos));
+	for (trabajador& t : trabajadores)
+		preparar(t.a, numEstados);
+	trabajadores[0].cola.push_back(raiz(M, C, divisor));
+
+	auto trabajar = [&](int yo) {
+		trabajador& t = trabajadores[yo];
+		comparador comp;
+		long long expandidos = 0;
+		while (pendientes.load() > 0 && !agotado.load()) {
+			nodo Y;
+			bool hay = false;
+			{
+				lock_guard<mutex> l(t.cerrojo);
+				if (!t.cola.empty()) {
+					pop_heap(t.cola.begin(), t.cola.end(), comp);
+					Y = t.cola.back(); t.cola.pop_back();
+					hay = true;
+				}
+			}
 
-	// Sacamos por pantalla el nmero de tipos
-	cout << "N = " << N << '\n';
+			// Si no tenemos trabajo, robamos el mejor nodo de otro hilo
+			for (int i = 1; !hay && i < hilos; ++i) {
+				trabajador& v = trabajadores[(yo + i) % hilos];
+				lock_guard<mutex> l(v.cerrojo);
+				if (v.cola.empty())
+					continue;
+				pop_heap(v.cola.begin(), v.cola.end(), comp);
+				Y = v.cola.back(); v.cola.pop_back();
+				hay = true;
+			}
+			if (!hay) {
+				this_thread::yield();
+				continue;
+			}
 
-	// Cuntas de cada tipo
-	/*for (int i = 0; i < N; i++) {
-		if (solucion[i] > 0)
-			salida << solucion[i] << " " << tiposMonedas[i - 1] << '\n';
+			if (Y.costeEstimado < coste_mejor.load()) {
+				++expandidos;
+				t.a.cola.clear();
+				expandir(M, C, divisor, Y, t.a,
+					[&]() { return coste_mejor.load(memory_order_relaxed); },
+					[&](int coste) {
+						int actual = coste_mejor.load();
+						while (coste < actual && !coste_mejor.compare_exchange_weak(actual, coste)) {}
+					});
+				// Contamos los hijos antes de meterlos, para que pendientes no llegue a cero si otro hilo los roba
+				if ((pendientes += (long long)t.a.cola.size()) > maxNodos)
+					agotado = true;
+				lock_guard<mutex> l(t.cerrojo);
+				for (nodo const& X : t.a.cola) {
+					t.cola.push_back(X);
+					push_heap(t.cola.begin(), t.cola.end(), comp);
+				}
+			}
+			--pendientes;
+		}
+		nodos += expandidos;
+	};
+
+	vector<thread> pool;
+	for (int i = 1; i < hilos; ++i)
+		pool.emplace_back(trabajar, i);
+	trabajar(0);
+	for (thread& h : pool)
+		h.join();
+	numNodos = (int)nodos.load();
+	if (agotado.load())
+		return -1;
+
+	int total = coste_mejor.load();
+	if (total != INT_MAX) {
+		almacen& a = almacenDelHilo((long long)N * (C + 1LL));
+		buscarDesglose(M, C, divisor, a, N, 0, 0, total, solucion.data());
 	}
-	*/
-	// Y el tiempo requerido
-	cout << "Tiempo requerido = " << tiempo << " segundos" << '\n';
-	cout << "Nmero de nodos: " << numNodos << '\n';
+	return total;
 }
 
 /*
-  Funcin que escribe en los ficheros
-
-  - El fichero "SalidaRYP" contiene la salida con toda la informacin
-  - El fichero "GraficaXRYP" contiene tan solo informacin de los tamaos de cara a pintar la grfica
-  - El fichero "GraficaYRYP" contiene tan solo informacin de los tiempos de cara a pintar la grfica
+  Adaptador de monedasRPMinimo a la interfaz común
 */
-void fichero() {
-
-	// Creamos los ficheros
-	ofstream salida("SalidaRYP.txt");
-	ofstream salidaGraficarX("GraficaXRYP.txt");
-	ofstream salidaGraficarY("GraficaYRYP.txt");
-
-	// Hacemos las pruebas en el intervalo de iteraciones decidido
-	for (int i = IT_MIN; i < IT_MAX + 1; i = i + SUMA)
-		prueba(i, salida, salidaGraficarX, salidaGraficarY);
+Resultado resolverRYP(vector<int> const &M, int C) {
+	Resultado r;
+	int numNodos = 0;
+	vector<int> solucion(M.size());
+	r.total = monedasRPMinimo(M, C, (int)M.size(), solucion, numNodos);
+	r.cuantas = solucion;
+	r.nodos = numNodos;
+	return r;
+}
 
-	// Cerramos los ficheros
-	salida.close();
-	salidaGraficarX.close();
-	salidaGraficarY.close();
+// Adaptador de monedasRPMinimoParalelo a la interfaz común, con tantos hilos como procesadores
+Resultado resolverRYPParalelo(vector<int> const &M, int C) {
+	Resultado r;
+	int numNodos = 0;
+	vector<int> solucion(M.size());
+	r.total = monedasRPMinimoParalelo(M, C, (int)M.size(), solucion, numNodos, max(1u, thread::hardware_concurrency()));
+	r.cuantas = solucion;
+	r.nodos = numNodos;
+	return r;
 }
 
-int main() {
-	fichero();
-	system("pause");
-	return 0;
-}
\ No newline at end of file
+/*
+  Versión de monedasRPMinimo sin reservas de memoria (en las llamadas en las que el almacén del hilo no crece)
+*/
+int resolverRYPSinReservas(vector<int> const &M, int C, Espacio &espacio, int *cuantas) {
+	int numNodos = 0;
+	int *solucion = cuantas != nullptr ? cuantas : espacio.pedir<int>(M.size());
+	return ramificacionYPoda(M, C, (int)M.size(), solucion, numNodos);
+}
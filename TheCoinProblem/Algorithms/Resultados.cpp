@@ -0,0 +1,241 @@
+/*
+	Problema de las monedas
+
+	Escritura asíncrona de los resultados de las pruebas
+
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
+	Universidad Complutense de Madrid
+
+	Beatriz Herguedas Pinedo
+*/
+
+#include <climits>
+#include <cmath>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Resultados.h"
+
+using namespace std;
+
+bool leerFormatos(string const &lista, unsigned &formatos) {
+	formatos = 0;
+	stringstream ss(lista);
+	string f;
+	while (getline(ss, f, ',')) {
+		if (f == "texto")
+			formatos |= TEXTO;
+		else if (f == "csv")
+			formatos |= CSV;
+		else if (f == "json")
+			formatos |= JSON;
+		else if (f == "binario")
+			formatos |= BINARIO;
+		else
+			return false;
+	}
+	return formatos != 0;
+}
+
+Sumidero::Sumidero(vector<string> const &algoritmos, unsigned formatos, uint64_t semilla, string const &familia,
+	bool conContadores)
+	: nombres(algoritmos), formatos(formatos), conContadores(conContadores), terminar(false) {
+
+	if (formatos & TEXTO) {
+		for (string const &nombre : nombres) {
+			ficheros.emplace_back(new Ficheros);
+			Ficheros &f = *ficheros.back();
+			f.salida.open("Salida" + nombre + ".txt");
+			f.salidaGraficarX.open("GraficaX" + nombre + ".txt");
+			f.salidaGraficarY.open("GraficaY" + nombre + ".txt");
+			f.estadisticas.open("Estadisticas" + nombre + ".txt");
+			f.estadisticas << "# semilla " << semilla << ' ' << familia << '\n';
+			f.estadisticas << "# algoritmo N C minimo mediana media p99 desviacion repeticiones lote";
+			if (conContadores) {
+				for (int c = 0; c < NUM_CONTADORES; ++c)
+					f.estadisticas << ' ' << Contadores::nombre(c);
+			}
+			f.estadisticas << '\n';
+		}
+	}
+
+	if (formatos & CSV) {
+		csv.open("Resultados.csv");
+		csv << "algoritmo,N,C,total,nodos,minimo,mediana,media,p99,desviacion,repeticiones,lote";
+		if (conContadores) {
+			for (int c = 0; c < NUM_CONTADORES; ++c)
+				csv << ',' << Contadores::nombre(c);
+		}
+		csv << '\n';
+	}
+
+	if (formatos & JSON)
+		json.open("Resultados.jsonl");
+
+	if (formatos & BINARIO) {
+		binario.open("Resultados.bin", ios::binary);
+		binario.write("MONEDAS2", 8);
+		binario.write((char const *)&semilla, sizeof(semilla));
+	}
+
+	hilo = thread(&Sumidero::trabajar, this);
+}
+
+Sumidero::~Sumidero() {
+	{
+		lock_guard<mutex> l(cerrojo);
+		terminar = true;
+	}
+	aviso.notify_one();
+	hilo.join();
+}
+
+void Sumidero::enviar(Registro r) {
+	{
+		lock_guard<mutex> l(cerrojo);
+		pendientes.push_back(move(r));
+	}
+	aviso.notify_one();
+}
+
+// Saca de golpe todos los registros pendientes y los escribe sin tener el cerrojo
+void Sumidero::trabajar() {
+	vector<Registro> lote;
+	while (true) {
+		{
+			unique_lock<mutex> l(cerrojo);
+			aviso.wait(l, [&]() { return terminar || !pendientes.empty(); });
+			if (pendientes.empty() && terminar)
+				break;
+			lote.swap(pendientes);
+		}
+		for (Registro const &r : lote)
+			escribir(r);
+		lote.clear();
+		cout.flush();
+	}
+}
+
+void Sumidero::escribir(Registro const &r) {
+	string const &nombre = nombres[r.algoritmo];
+	Estadisticas const &e = r.estadisticas;
+
+	// El tiempo de la prueba es la mediana de las muestras
+	double tiempo = e.mediana;
+
+	if (formatos & TEXTO) {
+		Ficheros &f = *ficheros[r.algoritmo];
+
+		// Primero en salida
+		f.salida << "Número de tipos de monedas que tenemos: " << r.N << '\n';
+		f.salida << "Queremos alcanzar la cantidad " << r.C << '\n';
+		if (r.total == INT_MAX)
+			f.salida << "No hemos encontrado solución\n";
+		else
+			f.salida << "Cantidad total de monedas utilizadas: " << r.total << '\n';
+
+		if (!r.usadas.empty()) {
+			f.salida << "Hemos cogido ";
+			for (auto const &u : r.usadas)
+				f.salida << u.first << " monedas del tipo " << u.second << '\n';
+		}
+
+		if (r.nodos > 0)
+			f.salida << "Número de nodos: " << r.nodos << '\n';
+
+		f.salida << "Tiempo requerido = " << tiempo << " segundos" << '\n';
+		f.salida << "--------------------------\n";
+
+		// Después en gráficaX
+		f.salidaGraficarX << r.N << '\n';
+
+		// Y por último en gráficaY
+		f.salidaGraficarY << fixed;
+		f.salidaGraficarY << setprecision(9) << tiempo << '\n';
+
+		// Y las estadísticas completas de la medición
+		f.estadisticas << scientific << setprecision(6);
+		f.estadisticas << nombre << ' ' << r.N << ' ' << r.C << ' ' << e.minimo << ' ' << e.mediana << ' ' << e.media << ' '
+			<< e.p99 << ' ' << e.desviacion << ' ' << e.repeticiones << ' ' << e.lote;
+
+		// Seguidas de los contadores por ejecución, con un guion si no están disponibles
+		if (conContadores) {
+			f.estadisticas << fixed << setprecision(1);
+			for (int c = 0; c < NUM_CONTADORES; ++c) {
+				if (e.contadores.valido[c])
+					f.estadisticas << ' ' << e.contadores.valor[c];
+				else
+					f.estadisticas << " -";
+			}
+		}
+		f.estadisticas << '\n';
+	}
+
+	if (formatos & CSV) {
+		csv << scientific << setprecision(6);
+		csv << nombre << ',' << r.N << ',' << r.C << ',' << r.total << ',' << r.nodos << ',' << e.minimo << ','
+			<< e.mediana << ',' << e.media << ',' << e.p99 << ',' << e.desviacion << ',' << e.repeticiones << ',' << e.lote;
+		if (conContadores) {
+			for (int c = 0; c < NUM_CONTADORES; ++c) {
+				csv << ',';
+				if (e.contadores.valido[c])
+					csv << e.contadores.valor[c];
+			}
+		}
+		csv << '\n';
+	}
+
+	if (formatos & JSON) {
+		json << scientific << setprecision(6);
+		json << "{\"algoritmo\":\"" << nombre << "\",\"N\":" << r.N << ",\"C\":" << r.C << ",\"total\":";
+		if (r.total == INT_MAX)
+			json << "null";
+		else
+			json << r.total;
+		json << ",\"usadas\":[";
+		for (size_t i = 0; i < r.usadas.size(); ++i)
+			json << (i ? "," : "") << '[' << r.usadas[i].first << ',' << r.usadas[i].second << ']';
+		json << "],\"nodos\":" << r.nodos << ",\"minimo\":" << e.minimo << ",\"mediana\":" << e.mediana
+			<< ",\"media\":" << e.media << ",\"p99\":" << e.p99 << ",\"desviacion\":" << e.desviacion
+			<< ",\"repeticiones\":" << e.repeticiones << ",\"lote\":" << e.lote;
+		if (conContadores) {
+			for (int c = 0; c < NUM_CONTADORES; ++c) {
+				json << ",\"" << Contadores::nombre(c) << "\":";
+				if (e.contadores.valido[c])
+					json << e.contadores.valor[c];
+				else
+					json << "null";
+			}
+		}
+		json << "}\n";
+	}
+
+	if (formatos & BINARIO) {
+		RegistroBinario b;
+		memset(&b, 0, sizeof(b));
+		strncpy(b.algoritmo, nombre.c_str(), sizeof(b.algoritmo) - 1);
+		b.N = r.N;
+		b.C = r.C;
+		b.total = r.total;
+		b.repeticiones = e.repeticiones;
+		b.nodos = r.nodos;
+		b.lote = e.lote;
+		b.minimo = e.minimo;
+		b.mediana = e.mediana;
+		b.media = e.media;
+		b.p99 = e.p99;
+		b.desviacion = e.desviacion;
+		for (int c = 0; c < NUM_CONTADORES; ++c)
+			b.contadores[c] = conContadores && e.contadores.valido[c] ? e.contadores.valor[c] : NAN;
+		binario.write((char const *)&b, sizeof(b));
+	}
+
+	// Sacamos por pantalla el algoritmo, el número de tipos y el tiempo requerido
+	cout << nombre << ": N = " << r.N << '\n';
+	cout << "Tiempo requerido = " << tiempo << " segundos" << '\n';
+}
@@ -0,0 +1,128 @@
+/*
+	Problema de las monedas
+
+	Escritura asíncrona de los resultados de las pruebas
+
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
+	Universidad Complutense de Madrid
+
+	Beatriz Herguedas Pinedo
+*/
+
+#ifndef RESULTADOS_H
+#define RESULTADOS_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "Medicion.h"
+
+// Formatos de salida (se pueden combinar con |)
+enum Formato {
+	TEXTO = 1,   // Salida<algoritmo>.txt, GraficaX<algoritmo>.txt, GraficaY<algoritmo>.txt y Estadisticas<algoritmo>.txt
+	CSV = 2,     // Resultados.csv, una fila por prueba
+	JSON = 4,    // Resultados.jsonl, un objeto JSON por línea y prueba
+	BINARIO = 8  // Resultados.bin, un RegistroBinario por prueba
+};
+
+// Convierte una lista separada por comas ("texto,csv,json,binario") en formatos; devuelve false si hay alguno desconocido
+bool leerFormatos(std::string const &lista, unsigned &formatos);
+
+/*
+  Resultado de una prueba
+
+  - algoritmo, posición del algoritmo en la lista con que se creó el Sumidero
+  - usadas, pares (cuántas monedas, tipo de moneda) de los tipos que se han usado
+  - nodos, número de nodos explorados (0 si el algoritmo no es de búsqueda)
+*/
+struct Registro {
+	int algoritmo;
+	int N;
+	long long C;
+	int total;
+	std::vector<std::pair<int, int>> usadas;
+	long long nodos;
+	Estadisticas estadisticas;
+};
+
+/*
+  Registro de tamaño fijo del formato binario (con el orden de bytes de la máquina); el fichero empieza por
+  la marca "MONEDAS2" y la semilla de 64 bits (la marca "MONEDASR" era la de los registros con C de 32 bits)
+*/
+struct RegistroBinario {
+	char algoritmo[16];
+	int32_t N;
+	int32_t total;
+	int64_t C;
+	int32_t repeticiones;
+	int64_t nodos;
+	int64_t lote;
+	double minimo;
+	double mediana;
+	double media;
+	double p99;
+	double desviacion;
+	double contadores[NUM_CONTADORES]; // NaN si el contador no se ha registrado
+};
+
+/*
+  Clase que recoge los resultados y los escribe en segundo plano
+
+  enviar solo mete el registro en una cola en memoria, así que el hilo que mide nunca espera al disco:
+  un hilo aparte saca todos los registros pendientes de golpe, les da formato y los escribe. También escribe
+  por pantalla el resumen de cada prueba. Al destruirse escribe lo que quede y cierra los ficheros
+*/
+class Sumidero {
+public:
+	/*
+	  Recibe como parámetros:
+	  algoritmos, los nombres de los algoritmos que se van a probar
+	  formatos, los formatos de salida
+	  semilla y familia, para las cabeceras
+	  conContadores, si las estadísticas traen contadores hardware
+	*/
+	Sumidero(std::vector<std::string> const &algoritmos, unsigned formatos, uint64_t semilla, std::string const &familia,
+		bool conContadores);
+	~Sumidero();
+
+	Sumidero(Sumidero const &) = delete;
+	Sumidero &operator=(Sumidero const &) = delete;
+
+	void enviar(Registro r);
+
+private:
+	// Ficheros de texto de cada algoritmo
+	struct Ficheros {
+		std::ofstream salida;
+		std::ofstream salidaGraficarX;
+		std::ofstream salidaGraficarY;
+		std::ofstream estadisticas;
+	};
+
+	void trabajar();
+	void escribir(Registro const &r);
+
+	std::vector<std::string> nombres;
+	unsigned formatos;
+	bool conContadores;
+	std::vector<std::unique_ptr<Ficheros>> ficheros;
+	std::ofstream csv;
+	std::ofstream json;
+	std::ofstream binario;
+
+	std::mutex cerrojo;
+	std::condition_variable aviso;
+	std::vector<Registro> pendientes;
+	bool terminar;
+	std::thread hilo;
+};
+
+#endif
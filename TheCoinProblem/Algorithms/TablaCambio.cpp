@@ -0,0 +1,137 @@
+/*
+	Problema de las monedas
+
+	Tabla precalculada de cambios para responder muchas consultas sobre un mismo sistema monetario
+
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
+	Universidad Complutense de Madrid
+
+	Beatriz Herguedas Pinedo
+*/
+
+#include <algorithm>
+#include <climits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "TablaCambio.h"
+
+using namespace std;
+
+/*
+  Función que comprueba los parámetros del constructor antes de reservar la tabla, para que un máximo
+  negativo o demasiado grande no llegue a los constructores de los vectores
+
+  Devuelve el número de cantidades de la tabla, maximo + 1
+*/
+static size_t tamanoTabla(vector<int> const &M, int maximo) {
+	if (maximo < 0)
+		throw invalid_argument("TablaCambio: el máximo no puede ser negativo");
+	if (maximo == INT_MAX)
+		throw length_error("TablaCambio: el máximo tiene que ser menor que INT_MAX");
+	for (int m : M) {
+		if (m <= 0)
+			throw invalid_argument("TablaCambio: los tipos de monedas deben ser positivos");
+	}
+	return (size_t)maximo + 1;
+}
+
+TablaCambio::TablaCambio(vector<int> const &M, int maximo)
+	: M(M), monedas(tamanoTabla(M, maximo), INT_MAX), ultima(monedas.size(), -1) {
+
+	// CASO BASE
+	monedas[0] = 0;
+
+	// RECURSIÓN
+	rellenar(1);
+}
+
+/*
+  Igual que en monedasPDVector, pero apuntando en ultima[j] la moneda con la que mejoramos j
+
+  Al recorrer las monedas para una cantidad j solo miramos cantidades j - M[i] más pequeñas: las que están por
+  debajo de "desde" ya tienen su valor óptimo definitivo, y las demás se van calculando igual que si
+  rellenáramos la tabla desde el principio, así que los mínimos son los mismos que al recalcularla entera
+  (el desglose puede usar otra moneda cuando hay empates, porque las cantidades antiguas ya tienen todas
+  las monedas aplicadas cuando se aplica la primera a las nuevas)
+*/
+void TablaCambio::rellenar(int desde) {
+	int N = M.size();
+	int hasta = maximo();
+	for (int i = 0; i < N; i++) {
+		int valor = M[i];
+		for (int j = max(valor, desde); j <= hasta; j++) {
+			if (monedas[j - valor] != INT_MAX && monedas[j - valor] + 1 < monedas[j]) {
+				monedas[j] = monedas[j - valor] + 1;
+				ultima[j] = i;
+			}
+		}
+	}
+}
+
+int TablaCambio::maximo() const {
+	return (int)monedas.size() - 1;
+}
+
+void TablaCambio::ampliar(int nuevoMaximo) {
+	int desde = maximo() + 1;
+	if (nuevoMaximo < desde)
+		return;
+	if (nuevoMaximo == INT_MAX)
+		throw length_error("TablaCambio: el máximo tiene que ser menor que INT_MAX");
+
+	// Las cantidades nuevas empiezan sin alcanzar, y solo calculamos esas
+	monedas.resize(nuevoMaximo + 1, INT_MAX);
+	ultima.resize(nuevoMaximo + 1, -1);
+	rellenar(desde);
+}
+
+TablaCambio TablaCambio::ampliada(int nuevoMaximo) const {
+	TablaCambio t(*this);
+	t.ampliar(nuevoMaximo);
+	return t;
+}
+
+vector<int> const &TablaCambio::tipos() const {
+	return M;
+}
+
+void TablaCambio::comprobar(int C) const {
+	if (C < 0 || C > maximo())
+		throw out_of_range("TablaCambio: la cantidad " + to_string(C) + " no está en la tabla");
+}
+
+int TablaCambio::minimo(int C) const {
+	comprobar(C);
+	return monedas[C];
+}
+
+void TablaCambio::desglose(int C, vector<int> &sol) const {
+	comprobar(C);
+	sol.clear();
+	if (monedas[C] == INT_MAX)
+		return;
+
+	// Vamos restando la moneda apuntada en cada cantidad hasta llegar a 0
+	sol.reserve(monedas[C]);
+	while (C > 0) {
+		sol.push_back(M[ultima[C]]);
+		C -= M[ultima[C]];
+	}
+}
+
+vector<int> TablaCambio::cuantas(int C) const {
+	comprobar(C);
+	vector<int> cuantas;
+	if (monedas[C] == INT_MAX)
+		return cuantas;
+
+	cuantas.assign(M.size(), 0);
+	while (C > 0) {
+		cuantas[ultima[C]]++;
+		C -= M[ultima[C]];
+	}
+	return cuantas;
+}
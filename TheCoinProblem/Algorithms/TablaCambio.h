@@ -0,0 +1,90 @@
+/*
+	Problema de las monedas
+
+	Tabla precalculada de cambios para responder muchas consultas sobre un mismo sistema monetario
+
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
+	Universidad Complutense de Madrid
+
+	Beatriz Herguedas Pinedo
+*/
+
+#ifndef TABLACAMBIO_H
+#define TABLACAMBIO_H
+
+#include <climits>
+#include <vector>
+
+/*
+  Clase que calcula una sola vez, con el mismo método que monedasPDVector, el número mínimo de monedas
+  de todas las cantidades entre 0 y un máximo, y guarda además qué moneda se usa en cada cantidad
+  para poder reconstruir la solución
+
+  Una vez construida la tabla no se modifica, así que varios hilos pueden consultarla a la vez
+  (por ejemplo compartiendo un shared_ptr<TablaCambio const>) sin ninguna sincronización
+
+  Hipótesis:
+  1. Cantidad de monedas disponible de cada tipo ilimitada
+  2. Los tipos de monedas son estrictamente positivos
+*/
+class TablaCambio {
+public:
+	/*
+	  Construye la tabla
+
+	  Recibe como parámetros:
+	  M, que es el vector que contiene los tipos de monedas (en cualquier orden)
+	  maximo, que es la mayor cantidad que vamos a consultar
+
+	  Lanza invalid_argument si maximo es negativo o alguna moneda no es positiva, y length_error si maximo es INT_MAX
+	*/
+	TablaCambio(std::vector<int> const &M, int maximo);
+
+	// Mayor cantidad que se puede consultar
+	int maximo() const;
+
+	/*
+	  Amplía la tabla hasta nuevoMaximo calculando solo las cantidades nuevas, en O(N * (nuevoMaximo - maximo()))
+	  (no hace nada si nuevoMaximo no es mayor que maximo(), y lanza length_error si es INT_MAX)
+
+	  Modifica la tabla, así que no se puede llamar mientras otros hilos la están consultando
+	*/
+	void ampliar(int nuevoMaximo);
+
+	/*
+	  Devuelve una copia de la tabla ampliada hasta nuevoMaximo, sin modificar esta
+
+	  Sirve para ampliar una tabla compartida: los lectores siguen usando la antigua hasta que se publica la nueva
+	*/
+	TablaCambio ampliada(int nuevoMaximo) const;
+
+	// Tipos de monedas del sistema
+	std::vector<int> const &tipos() const;
+
+	// Número mínimo de monedas para alcanzar C en O(1), o INT_MAX si no se puede alcanzar
+	int minimo(int C) const;
+
+	/*
+	  Función que reconstruye la solución de C en O(número de monedas)
+
+	  Escribe en sol el valor de cada una de las monedas utilizadas (sol queda vacío si C no se puede alcanzar)
+	*/
+	void desglose(int C, std::vector<int> &sol) const;
+
+	// Cuántas monedas del tipo tipos()[i] se usan para alcanzar C (vacío si C no se puede alcanzar)
+	std::vector<int> cuantas(int C) const;
+
+private:
+	// Comprueba que C está en la tabla y lanza out_of_range si no
+	void comprobar(int C) const;
+
+	// Calcula las cantidades desde "desde" hasta maximo(), suponiendo que las anteriores ya son definitivas
+	void rellenar(int desde);
+
+	std::vector<int> M;
+	std::vector<int> monedas; // monedas[j], número mínimo de monedas para alcanzar j
+	std::vector<int> ultima;  // ultima[j], índice en M de una moneda de alguna solución óptima de j
+};
+
+#endif
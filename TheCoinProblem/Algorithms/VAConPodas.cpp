@@ -0,0 +1,182 @@
+/*
+	Problema de las monedas
+
+	Implementación con método de vuelta atrás con podas y memoria de estados
+
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
+	Universidad Complutense de Madrid
+
+	Beatriz Herguedas Pinedo
+*/
+
+#include <algorithm>
+#include <climits>
+#include <numeric>
+#include <vector>
+
+#include "Monedas.h"
+
+using namespace std;
+
+// Memoria por defecto de la tabla de estados del adaptador
+long long const MEMORIA_CACHE = 64LL << 20;
+
+// Valor que representa que no hay solución (lo bastante pequeño para poder sumarle monedas sin desbordar)
+int const SIN_SOLUCION = INT_MAX / 2;
+
+/*
+  Entrada de la tabla de estados (tipo, C)
+
+  Si exacto, valor es el mínimo número de monedas para pagar C con los tipos 0..tipo. Si no, es una cota
+  inferior: una búsqueda anterior con ese límite no encontró nada mejor
+*/
+struct entrada {
+	long long clave; // tipo * (C total + 1) + C, o -1 si la posición está vacía
+	int valor;
+	bool exacto;
+};
+
+// Estado de una búsqueda (la memoria de divisor y tabla es del espacio de trabajo)
+struct busqueda {
+	vector<int> const &M;
+	long long cantidadTotal;
+	int *divisor; // divisor[t] es el máximo común divisor de M[0..t-1]
+	entrada *tabla; // Nula si no hay memoria para ella
+	size_t tam; // Posiciones de la tabla (una potencia de 2)
+	long long nodos;
+};
+
+static entrada *buscarEntrada(busqueda &b, int tipo, int C) {
+	if (b.tabla == nullptr)
+		return nullptr;
+	long long clave = tipo * (b.cantidadTotal + 1) + C;
+	return &b.tabla[(size_t)(clave * 0x9E3779B97F4A7C15ULL >> 20) & (b.tam - 1)];
+}
+
+/*
+  Función que calcula el mínimo número de monedas para pagar C con los tipos de monedas 0..tipo,
+  siempre que sea menor que cota
+
+  Devuelve ese mínimo si es menor que cota, y si no un valor mayor o igual que cota
+
+  Poda con la cota ceil(C / M[tipo]) (aunque todas las monedas que quedan fuesen de la mayor de ellas
+  necesitaríamos al menos esas), prueba primero el mayor número posible de monedas del tipo actual, y
+  guarda en la tabla lo aprendido de cada estado (tipo, C)
+*/
+static int buscar(busqueda &b, int tipo, int C, int cota) {
+	b.nodos++;
+	if (C == 0)
+		return 0;
+	if (tipo < 0 || C % b.divisor[tipo + 1] != 0)
+		return SIN_SOLUCION;
+	int moneda = b.M[tipo];
+	int minimoPosible = (C - 1) / moneda + 1;
+	if (minimoPosible >= cota)
+		return minimoPosible;
+
+	long long clave = tipo * (b.cantidadTotal + 1) + C;
+	entrada *e = buscarEntrada(b, tipo, C);
+	if (e != nullptr && e->clave == clave && (e->exacto || e->valor >= cota))
+		return e->valor;
+
+	int mejor = cota;
+	for (int i = C / moneda; i >= 0; --i) {
+		int resto = C - i * moneda;
+		if (tipo > 0) {
+			// Cota optimista del resto con la siguiente moneda: si ya no mejora, con menos monedas de este tipo tampoco
+			long long siguiente = b.M[tipo - 1];
+			if ((long long)i * siguiente + resto >= (long long)mejor * siguiente)
+				break;
+		}
+		else if (resto != 0)
+			continue;
+		int r = buscar(b, tipo - 1, resto, mejor - i);
+		if (r + i < mejor)
+			mejor = r + i;
+	}
+
+	if (e != nullptr) {
+		e->clave = clave;
+		e->exacto = mejor < cota;
+		e->valor = mejor;
+	}
+	return mejor;
+}
+
+/*
+  Función que hace el cálculo de vueltaAtrasPodada con la memoria del espacio de trabajo, escribiendo la
+  solución en cuantas[0..N-1]
+*/
+static int buscarConPodas(vector<int> const &M, int C, Espacio &espacio, int *cuantas, long long memoriaCache, long long &nodos) {
+	int N = M.size();
+	busqueda b{ M, C, espacio.pedir<int>(N + 1, 0), nullptr, 1, 0 };
+	b.divisor[0] = 0;
+	for (int t = 1; t <= N; ++t)
+		b.divisor[t] = gcd(b.divisor[t - 1], M[t - 1]);
+	long long estados = (long long)N * (C + 1LL);
+	while ((long long)(2 * b.tam * sizeof(entrada)) <= memoriaCache && (long long)b.tam < estados)
+		b.tam *= 2;
+	if ((long long)(b.tam * sizeof(entrada)) <= memoriaCache) {
+		b.tabla = espacio.pedir<entrada>(b.tam, 1);
+		fill(b.tabla, b.tabla + b.tam, entrada{ -1, 0, false });
+	}
+
+	fill(cuantas, cuantas + N, 0);
+	int total = buscar(b, N - 1, C, SIN_SOLUCION);
+	if (total >= SIN_SOLUCION) {
+		nodos = b.nodos;
+		return INT_MAX;
+	}
+
+	// Reconstruimos el desglose bajando por los tipos y buscando cuántas monedas de cada uno llevan al óptimo
+	int resto = C, falta = total;
+	for (int tipo = N - 1; tipo >= 0 && resto > 0; --tipo) {
+		for (int i = resto / M[tipo]; i >= 0; --i) {
+			if (buscar(b, tipo - 1, resto - i * M[tipo], falta - i + 1) == falta - i) {
+				cuantas[tipo] = i;
+				resto -= i * M[tipo];
+				falta -= i;
+				break;
+			}
+		}
+	}
+	nodos = b.nodos;
+	return total;
+}
+
+/*
+  Función que resuelve el problema de las monedas con el método de vuelta atrás con podas
+
+  Recibe como parámetros:
+  M, que es el vector que contiene los tipos de monedas, ordenado crecientemente
+  C, que es la cantidad que queremos alcanzar
+  cuantas, donde se devuelve cuántas monedas del tipo M[i] se usan
+  memoriaCache, bytes como mucho para la tabla de estados (0 para no usarla)
+  nodos, número de llamadas de la búsqueda
+
+  Devuelve el mínimo número de monedas necesario para alcanzar la cantidad C (INT_MAX si no se puede)
+
+  La tabla de estados es de acceso directo por dispersión: si dos estados caen en la misma posición el último
+  sustituye al anterior, así que la memoria acota lo que se recuerda pero no afecta al resultado
+*/
+int vueltaAtrasPodada(vector<int> const &M, int C, vector<int> &cuantas, long long memoriaCache, long long &nodos) {
+	Espacio espacio;
+	cuantas.assign(M.size(), 0);
+	return buscarConPodas(M, C, espacio, cuantas.data(), memoriaCache, nodos);
+}
+
+// Versión de vueltaAtrasPodada sin reservas de memoria, con la memoria por defecto para la tabla de estados
+int resolverVAPodasSinReservas(vector<int> const &M, int C, Espacio &espacio, int *cuantas) {
+	long long nodos = 0;
+	int *solucion = cuantas != nullptr ? cuantas : espacio.pedir<int>(M.size(), 2);
+	return buscarConPodas(M, C, espacio, solucion, MEMORIA_CACHE, nodos);
+}
+
+// Adaptador de vueltaAtrasPodada a la interfaz común
+Resultado resolverVAPodas(vector<int> const &M, int C) {
+	Resultado r;
+	int total = vueltaAtrasPodada(M, C, r.cuantas, MEMORIA_CACHE, r.nodos);
+	r.total = total;
+	return r;
+}
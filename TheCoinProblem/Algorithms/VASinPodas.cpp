@@ -11,42 +11,26 @@
 */
 
 #include <algorithm>
+#include <atomic>
 #include <climits>
-#include <cmath>
-#include <ctime>
-#include <fstream>
-#include <iomanip>
-#include <iostream>
-#include <list>
-#include <stdio.h>
-#include <stdlib.h> 
-#include <time.h>
-#include <unordered_map>
+#include <thread>
 #include <vector>
 
-using namespace std;
-
-// Constantes que indican el intervalo del número de iteraciones del bucle
-int const IT_MIN = 10;
-int const IT_MAX = 25;
-
-// De cuánto en cuánto se va iterando el bucle
-int const SUMA = 1;
+#include "Monedas.h"
 
-// Constantes que indican el intervalo en el que queremos que se mueva el random
-int const RA_MIN = 1;
-int const RA_MAX = 2;
+using namespace std;
 
 /*
   Función que resuelve el problema de las monedas con el método de vuelta atrás,
   teniendo en cuenta las hipótesis necesarias:
-  1. Los tipos de monedas están ordenados en orden estrictamente decreciente
+  1. Los tipos de monedas están ordenados en orden estrictamente creciente, y la búsqueda los recorre desde el
+     mayor: la primera llamada recibe tipo = M.size() - 1 y cada nivel baja al tipo anterior
   2. Cantidad de monedas disponible de cada tipo ilimitada
 
   Recibe como parámetros:
   C, que es la cantidad que queremos alcanzar
-  tipo, que es el tipo de moneda que estamos probando en cada momento
-  monedasUsadas, que es el número de tipos de monedas que hemos usado
+  tipo, que es el tipo de moneda que estamos probando en cada momento (solo quedan por decidir los tipos 0..tipo)
+  monedasUsadas, que es el número de monedas que hemos usado
   M, que es el vector que contiene el sistema monetario o monedas a usar
   
   Devuelve el mínimo número de monedas necesario para alcanzar la cantidad C
@@ -65,127 +49,83 @@ int vueltaAtras(int C, int tipo, int monedasUsadas, vector<int> const& M) {
 	return minimo;
 }
 
-/*
-  Función que realiza las pruebas
-
-  Recibe como parámetros:
-  N, que es el número total de tipos de monedas que tenemos
-  salida, flujo de salida para escribir por fichero toda la información necesaria sobre la prueba
-  salidaGraficaX, flujo de salida para escribir por fichero la información sobre el tamaño de la prueba
-  salidaGraficaY, flujo de salida para escribir por fichero la información sobre el tiempo que ha durado la prueba
-*/
-void prueba(int N, ofstream &salida, ofstream &salidaGraficarX, ofstream &salidaGraficarY) {
-
-	// Generamos la semilla del random en función del tiempo
-	srand(time(NULL));
-
-	// Creamos la base (queremos que sea siempre 2 porque si no al hacer las potencias nos salimos de rango)
-	int base = 2;
-
-	// Creamos nuestra moneda, que inicializamos al valor de la base
-	int valorMoneda = base;
-
-	// Creamos el vector que va a almacenar los tipos de monedas e insertamos un 1 (pues la primera potencia es elevar a 0)
-	vector<int> tiposMonedas;
-	tiposMonedas.push_back(1);
-
-	// Recorremos el vector insertando los tipos de monedas
-	for (int i = 1; i < N; i++) {
-		tiposMonedas.push_back(valorMoneda);
-
-		// La siguiente moneda a insertar será la sigiente potencia, es decir, volver a multiplicar por la base
-		valorMoneda *= base;
-	}
-
-	// Creamos el vector en el que vamos a devolver cuántas monedas de cada tipo hemos utilizado
-	vector <pair<int, int>> w;
-
-	// Le damos un valor a C, que es la cantidad que queremos alcanzar para resolver el problema
-	// En este caso el valor elegido es 2^N
-	int C = 2 * N;
-
-	// Inicializamos el número total de monedas utilizadas a 0
-	int totalutilizadas = 0;
-
-	// Nos guardamos el tiempo justo antes de realizar la prueba
-	int t0 = clock();
+// Tareas por hilo que intentamos generar al repartir los primeros niveles del árbol
+int const TAREAS_POR_HILO = 8;
 
-	// Realizamos la prueba llamando a la función que calcula la solución
-	totalutilizadas = vueltaAtras(C, N-1, 0, tiposMonedas);
+// Subárbol pendiente de explorar: los mismos parámetros que recibe vueltaAtras
+struct tarea {
+	int C;
+	int tipo;
+	int monedasUsadas;
+};
 
+/*
+  Versión paralela de vueltaAtras con hilos hilos
 
+  Desarrollamos los primeros niveles del árbol (cuántas monedas tomamos de los tipos más grandes) hasta tener
+  unas TAREAS_POR_HILO tareas por hilo, o como mucho niveles niveles. Cada hilo toma la siguiente tarea
+  pendiente, la resuelve con vueltaAtras y combina su resultado con el mínimo compartido. Antes de empezar una
+  tarea la descartamos si, aunque pagase todo lo que le queda con la moneda mayor que le queda, no mejoraría
+  ese mínimo
 
-	// Nos guardamos el tiempo justo al terminar la prueba
-	int t1 = clock();
-
-	// Calculamos el tiempo que ha durado la prueba restando el inicial al final
-	double tiempo = double(t1 - t0) / CLOCKS_PER_SEC;
-
-	/////////////////////////////////////////////////////////////////////////////
-	// Ahora escribimos en los archivos
-
-	// Primero en salida
-	salida << "Número de tipos de monedas que tenemos: " << N << '\n';
-	salida << "Queremos alcanzar la cantidad " << C << '\n';
-	salida << "Cantidad total de monedas utilizadas: " << totalutilizadas << '\n';
-
-	salida << "Hemos cogido ";
-	for (auto m : w) {
-		if (m.first > 0)
-			salida << m.first << " monedas del tipo " << m.second << '\n';
-	}
-
-	salida << "Tiempo requerido = " << tiempo << " segundos" << '\n';
-	salida << "--------------------------\n";
-
-	// Después en gráficaX
-	salidaGraficarX << N << '\n';
-
-	// Y por último en gráficaY
-	salidaGraficarY << fixed;
-	salidaGraficarY << setprecision(3) << tiempo << '\n';
-
-	/////////////////////////////////////////////////////////////////////////////
-
-	// Sacamos por pantalla el número de tipos
-	cout << "N = " << N << '\n';
-
-	// Cuántas de cada tipo
-	for (auto m : w) {
-		if (m.first > 0)
-			cout << m.first << " " << m.second << '\n';
+  Devuelve el mínimo número de monedas necesario para alcanzar la cantidad C
+*/
+int vueltaAtrasParalelo(int C, vector<int> const& M, int hilos, int niveles) {
+	hilos = max(1, hilos);
+	vector<tarea> tareas = { { C, (int)M.size() - 1, 0 } };
+	for (int nivel = 0; nivel < niveles && (int)tareas.size() < TAREAS_POR_HILO * hilos; ++nivel) {
+		vector<tarea> siguientes;
+		for (tarea const& t : tareas) {
+			if (t.C == 0 || t.tipo < 0) {
+				siguientes.push_back(t);
+				continue;
+			}
+			// Primero las que toman más monedas del tipo actual, que suelen dar antes un buen mínimo
+			for (int i = t.C / M[t.tipo]; i >= 0; i--)
+				siguientes.push_back({ t.C - M[t.tipo] * i, t.tipo - 1, t.monedasUsadas + i });
+		}
+		tareas.swap(siguientes);
 	}
 
-	// Y el tiempo requerido
-	cout << "Tiempo requerido = " << tiempo << " segundos" << '\n';
+	atomic<int> minimo(INT_MAX);
+	atomic<size_t> siguiente(0);
+	auto trabajar = [&]() {
+		for (size_t j = siguiente++; j < tareas.size(); j = siguiente++) {
+			tarea const& t = tareas[j];
+			if (t.C > 0 && t.tipo >= 0) {
+				long long cota = t.monedasUsadas + (t.C + M[t.tipo] - 1LL) / M[t.tipo];
+				if (cota >= minimo.load(memory_order_relaxed))
+					continue;
+			}
+			int r = vueltaAtras(t.C, t.tipo, t.monedasUsadas, M);
+			int actual = minimo.load();
+			while (r < actual && !minimo.compare_exchange_weak(actual, r)) {}
+		}
+	};
+
+	vector<thread> pool;
+	for (int i = 1; i < hilos; ++i)
+		pool.emplace_back(trabajar);
+	trabajar();
+	for (thread& h : pool)
+		h.join();
+	return minimo.load();
 }
 
 /*
-  Función que escribe en los ficheros
+  Adaptador de vueltaAtras a la interfaz común
 
-  - El fichero "SalidaVA" contiene la salida con toda la información
-  - El fichero "GraficaXVA" contiene tan solo información de los tamaños de cara a pintar la gráfica
-  - El fichero "GraficaYVA" contiene tan solo información de los tiempos de cara a pintar la gráfica
+  La vuelta atrás sin podas solo calcula el número mínimo de monedas, no cuántas de cada tipo
 */
-void fichero() {
-
-	// Creamos los ficheros
-	ofstream salida("SalidaVA.txt");
-	ofstream salidaGraficarX("GraficaXVA.txt");
-	ofstream salidaGraficarY("GraficaYVA.txt");
-
-	// Hacemos las pruebas en el intervalo de iteraciones decidido
-	for (int i = IT_MIN; i < IT_MAX + 1; i = i + SUMA)
-		prueba(i, salida, salidaGraficarX, salidaGraficarY);
-
-	// Cerramos los ficheros
-	salida.close();
-	salidaGraficarX.close();
-	salidaGraficarY.close();
+Resultado resolverVA(vector<int> const &M, int C) {
+	Resultado r;
+	r.total = vueltaAtras(C, (int)M.size() - 1, 0, M);
+	return r;
 }
 
-int main() {
-	fichero();
-	system("pause");
-	return 0;
-}
\ No newline at end of file
+// Adaptador de vueltaAtrasParalelo a la interfaz común, con tantos hilos como procesadores
+Resultado resolverVAParalelo(vector<int> const &M, int C) {
+	Resultado r;
+	r.total = vueltaAtrasParalelo(C, M, max(1u, thread::hardware_concurrency()), (int)M.size());
+	return r;
+}
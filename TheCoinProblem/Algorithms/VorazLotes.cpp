@@ -0,0 +1,80 @@
+/*
+	Problema de las monedas
+
+	Método voraz por lotes de cantidades
+
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
+	Universidad Complutense de Madrid
+
+	Beatriz Herguedas Pinedo
+*/
+
+#include <climits>
+#include <cstdint>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "VorazLotes.h"
+
+using namespace std;
+
+/*
+  Para dividir números de 31 bits por d, sea l el menor entero con 2^l >= d y m = ceil(2^(31 + l) / d).
+  Entonces m cabe en 32 bits, m * d - 2^(31 + l) < d <= 2^l, y por el teorema de Granlund y Montgomery
+  x / d == (x * m) >> (31 + l) para todo x < 2^31
+*/
+VorazLotes::VorazLotes(vector<int> const &M) : M(M) {
+	for (int d : M) {
+		int l = 0;
+		while ((1LL << l) < d)
+			l++;
+		uint64_t potencia = 1ULL << (31 + l);
+		multiplicador.push_back(uint32_t((potencia + d - 1) / d));
+		desplazamiento.push_back(31 + l);
+	}
+}
+
+void VorazLotes::resolver(int32_t const *cantidades, size_t n, int32_t *cuantas, size_t paso, int32_t *totales) const {
+	int N = M.size();
+	size_t j = 0;
+
+#if defined(__AVX2__)
+	// De 8 en 8: los carriles pares e impares se multiplican por separado (producto de 32 x 32 a 64 bits)
+	for (; j + 8 <= n; j += 8) {
+		__m256i falta = _mm256_loadu_si256((__m256i const *)(cantidades + j));
+		__m256i total = _mm256_setzero_si256();
+		for (int i = N - 1; i >= 0; --i) {
+			__m256i m = _mm256_set1_epi32((int)multiplicador[i]);
+			__m128i s = _mm_cvtsi32_si128(desplazamiento[i]);
+			__m256i pares = _mm256_srl_epi64(_mm256_mul_epu32(falta, m), s);
+			__m256i impares = _mm256_srl_epi64(_mm256_mul_epu32(_mm256_srli_epi64(falta, 32), m), s);
+			__m256i q = _mm256_blend_epi32(pares, _mm256_slli_epi64(impares, 32), 0xAA);
+			falta = _mm256_sub_epi32(falta, _mm256_mullo_epi32(q, _mm256_set1_epi32(M[i])));
+			total = _mm256_add_epi32(total, q);
+			if (cuantas != nullptr)
+				_mm256_storeu_si256((__m256i *)(cuantas + i * paso + j), q);
+		}
+		// Las cantidades en las que sobra algo no se alcanzan
+		__m256i alcanzada = _mm256_cmpeq_epi32(falta, _mm256_setzero_si256());
+		total = _mm256_blendv_epi8(_mm256_set1_epi32(INT_MAX), total, alcanzada);
+		_mm256_storeu_si256((__m256i *)(totales + j), total);
+	}
+#endif
+
+	for (; j < n; ++j) {
+		uint32_t falta = cantidades[j];
+		int32_t total = 0;
+		for (int i = N - 1; i >= 0; --i) {
+			uint32_t q = uint32_t((uint64_t(falta) * multiplicador[i]) >> desplazamiento[i]);
+			falta -= q * M[i];
+			total += q;
+			if (cuantas != nullptr)
+				cuantas[i * paso + j] = q;
+		}
+		totales[j] = falta == 0 ? total : INT_MAX;
+	}
+}
@@ -0,0 +1,62 @@
+/*
+	Problema de las monedas
+
+	Método voraz por lotes de cantidades
+
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
+	Universidad Complutense de Madrid
+
+	Beatriz Herguedas Pinedo
+*/
+
+#ifndef VORAZLOTES_H
+#define VORAZLOTES_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/*
+  Clase que aplica el método voraz de monedasVoraz1 a muchas cantidades a la vez
+
+  Al construirla se calcula una sola vez, para cada tipo de moneda, un multiplicador y un desplazamiento
+  con los que la división entera por la moneda se convierte en una multiplicación y un desplazamiento
+  (el método de Granlund y Montgomery). Después las cantidades se procesan de 8 en 8 con AVX2 (o de una en
+  una si no está disponible), sin ninguna división
+
+  Solo da la solución óptima si el sistema es canónico (ver Canonico.h)
+
+  Hipótesis:
+  1. Los tipos de monedas están ordenados en orden estrictamente creciente
+  2. Las cantidades están entre 0 y INT_MAX
+*/
+class VorazLotes {
+public:
+	explicit VorazLotes(std::vector<int> const &M);
+
+	/*
+	  Resuelve las cantidades cantidades[0..n-1]
+
+	  Recibe como parámetros:
+	  cantidades, las cantidades a pagar
+	  n, cuántas son
+	  cuantas, tabla por tipos de moneda (estructura de vectores) de M.size() filas de paso elementos:
+	  en cuantas[i * paso + j] se escriben las monedas del tipo M[i] para cantidades[j]. Puede ser nulo
+	  si solo interesan los totales
+	  paso, separación entre filas de cuantas (al menos n)
+	  totales, donde se escribe el número total de monedas de cada cantidad, o INT_MAX si el método voraz
+	  no la alcanza
+
+	  No pide memoria: todo se escribe en los vectores del llamante
+	*/
+	void resolver(int32_t const *cantidades, std::size_t n, int32_t *cuantas, std::size_t paso, int32_t *totales) const;
+
+private:
+	// x / M[i] == (x * multiplicador[i]) >> desplazamiento[i] para todo x < 2^31
+	std::vector<uint32_t> multiplicador;
+	std::vector<int> desplazamiento;
+	std::vector<int> M;
+};
+
+#endif
@@ -0,0 +1,204 @@
+/*
+	Problema de las monedas
+
+	Implementación con búsqueda en anchura sobre conjuntos de bits
+
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
+	Universidad Complutense de Madrid
+
+	Beatriz Herguedas Pinedo
+*/
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "Monedas.h"
+
+using namespace std;
+
+// Número de palabras de cada bloque (16 KB, para que el bloque de destino quepa en la caché L1)
+int const BLOQUE_PALABRAS = 2048;
+
+// Número máximo de niveles: con más de 64 el coste ya es mayor que el de la programación dinámica con vector
+// (y la memoria de los niveles, mayor que la del vector de enteros), así que pasamos a usar monedasPDVector
+int const MAX_NIVELES = 64;
+
+/*
+  Función que añade a las palabras [desde, hasta) de destino el conjunto origen desplazado valor posiciones:
+  destino |= origen << valor
+
+  Recibe como parámetros:
+  destino y origen, que son conjuntos de cantidades entre 0 y C, un bit por cantidad (palabras de 64 bits)
+  valor, que es el desplazamiento (el valor de la moneda)
+  desde y hasta, que son las palabras de destino que calculamos
+
+  Trabaja palabra a palabra, así que procesa 64 cantidades en cada operación (256 con AVX2)
+*/
+static void desplazarYSumar(uint64_t *d, uint64_t const *o, int valor, int desde, int hasta) {
+	int s = valor / 64;
+	int b = valor % 64;
+
+	int i = max(desde, s);
+	if (i == s && i < hasta) {
+		d[s] |= o[0] << b;
+		i++;
+	}
+
+#if defined(__AVX2__)
+	// Los desplazamientos vectoriales de 64 o más posiciones dan 0, así que b == 0 no es un caso especial
+	__m128i const izquierda = _mm_cvtsi32_si128(b);
+	__m128i const derecha = _mm_cvtsi32_si128(64 - b);
+	for (; i + 4 <= hasta; i += 4) {
+		__m256i alto = _mm256_loadu_si256((__m256i const *)(o + i - s));
+		__m256i bajo = _mm256_loadu_si256((__m256i const *)(o + i - s - 1));
+		__m256i desplazado = _mm256_or_si256(_mm256_sll_epi64(alto, izquierda), _mm256_srl_epi64(bajo, derecha));
+		__m256i actual = _mm256_loadu_si256((__m256i const *)(d + i));
+		_mm256_storeu_si256((__m256i *)(d + i), _mm256_or_si256(actual, desplazado));
+	}
+#endif
+
+	for (; i < hasta; ++i)
+		d[i] |= (o[i - s] << b) | (b == 0 ? 0 : o[i - s - 1] >> (64 - b));
+}
+
+// Función que dice si la cantidad c está en el conjunto
+static bool contiene(uint64_t const *conjunto, int c) {
+	return (conjunto[c / 64] >> (c % 64)) & 1;
+}
+
+/*
+  Función que hace el cálculo de monedasBFS con la memoria del espacio de trabajo: los niveles se guardan
+  uno detrás de otro en un solo bloque, que crece a medida que se añaden
+
+  Escribe en cuantas[i] cuántas monedas del tipo v[i] hemos utilizado (si cuantas no es nulo)
+  y devuelve el número mínimo de monedas (INT_MAX si no hay solución)
+*/
+static int buscarNiveles(vector<int> const &v, int C, Espacio &espacio, int *cuantas) {
+
+	// Guardamos en N el número de tipos de moneda que tenemos
+	int N = v.size();
+
+	if (cuantas != nullptr)
+		fill(cuantas, cuantas + N, 0);
+
+	if (C == 0)
+		return 0;
+
+	// Si C no es múltiplo del máximo común divisor de las monedas no hay solución
+	int mcd = 0;
+	for (int valor : v)
+		mcd = gcd(mcd, valor);
+	if (mcd == 0 || C % mcd != 0)
+		return INT_MAX;
+
+	// Número de palabras de cada conjunto, y máscara de los bits válidos de la última
+	int palabras = C / 64 + 1;
+	uint64_t mascara = (C % 64 == 63) ? ~0ULL : ((1ULL << (C % 64 + 1)) - 1);
+
+	// El nivel k (las cantidades que se alcanzan con k monedas o menos) empieza en niveles + k * palabras
+	uint64_t *niveles = espacio.pedir<uint64_t>(palabras);
+	fill(niveles, niveles + palabras, 0);
+	niveles[0] = 1;
+	int num = 0;
+
+	while (!contiene(niveles + (size_t)num * palabras, C)) {
+		// Calculamos el siguiente nivel por bloques, aplicando todas las monedas a un bloque antes del siguiente
+		niveles = espacio.pedir<uint64_t>((size_t)(num + 2) * palabras);
+		uint64_t const *actual = niveles + (size_t)num * palabras;
+		uint64_t *siguiente = niveles + (size_t)(num + 1) * palabras;
+		for (int desde = 0; desde < palabras; desde += BLOQUE_PALABRAS) {
+			int hasta = min(palabras, desde + BLOQUE_PALABRAS);
+			copy(actual + desde, actual + hasta, siguiente + desde);
+			for (int valor : v) {
+				if (valor <= C)
+					desplazarYSumar(siguiente, actual, valor, desde, hasta);
+			}
+		}
+		siguiente[palabras - 1] &= mascara;
+
+		// Si no hemos alcanzado ninguna cantidad nueva, C no se puede alcanzar
+		if (equal(actual, actual + palabras, siguiente))
+			return INT_MAX;
+
+		num++;
+
+		if (num + 1 > MAX_NIVELES)
+			return resolverPDVectorSinReservas(v, C, espacio, cuantas);
+	}
+
+	/////////////////////////////////////////////////////////////////////////////
+	// Ahora vamos a reconstruir la solución
+
+	// Desde C con k monedas, buscamos una moneda que nos lleve a una cantidad alcanzable con k - 1
+	int j = C;
+	for (int k = num; k > 0 && cuantas != nullptr; --k) {
+		uint64_t const *anterior = niveles + (size_t)(k - 1) * palabras;
+		int i = 0;
+		while (v[i] > j || !contiene(anterior, j - v[i]))
+			i++;
+
+		cuantas[i]++;
+		j -= v[i];
+	}
+
+	return num;
+}
+
+/*
+  Función que resuelve el problema de las monedas como un camino mínimo desde 0 hasta C,
+  teniendo en cuenta las hipótesis necesarias:
+  1. Cantidad de monedas disponible de cada tipo ilimitada
+  2. El número de tipos de monedas sea finito
+
+  Recibe como parámetros:
+  v, que es el vector que contiene los tipos de monedas
+  C, que es la cantidad que queremos alcanzar
+  totalutilizados, que es el número total de monedas que utilizamos
+
+  En el nivel k guardamos como conjunto de bits las cantidades que se alcanzan con k monedas o menos.
+  El nivel k + 1 es el nivel k unido con el nivel k desplazado por cada una de las monedas, y paramos
+  en cuanto aparece C. Así el coste es O(solución * N * C / 64) operaciones con palabras en vez de O(N * C)
+
+  Si C no es múltiplo del máximo común divisor de las monedas, o un nivel no añade ninguna cantidad nueva,
+  la cantidad no se puede alcanzar y paramos sin recorrer nada más. Si la solución necesita más de MAX_NIVELES
+  monedas, resolvemos con monedasPDVector
+
+  La función devuelve un par con el número mínimo de monedas necesario para resolver el problema
+  (INT_MAX si no hay solución) y el vector que contiene cuántas monedas del tipo v[i] hemos utilizado
+*/
+pair<int, vector<int>> monedasBFS(vector<int> const &v, int C, int &totalutilizados) {
+	Espacio espacio;
+
+	// Creamos el vector que va a almacenar cuántas monedas del tipo v[i] hemos utilizado
+	vector<int> cuantas(v.size());
+	int num = buscarNiveles(v, C, espacio, cuantas.data());
+
+	// Sumamos al número total de monedas utilizado las de la solución
+	if (num != INT_MAX)
+		totalutilizados += num;
+
+	return { num, cuantas };
+}
+
+// Adaptador de monedasBFS a la interfaz común
+Resultado resolverBFS(vector<int> const &M, int C) {
+	Resultado r;
+	int totalutilizados = 0;
+	auto sol = monedasBFS(M, C, totalutilizados);
+	r.total = sol.first;
+	r.cuantas = sol.second;
+	return r;
+}
+
+// Versión de monedasBFS sin reservas de memoria
+int resolverBFSSinReservas(vector<int> const &M, int C, Espacio &espacio, int *cuantas) {
+	return buscarNiveles(M, C, espacio, cuantas);
+}
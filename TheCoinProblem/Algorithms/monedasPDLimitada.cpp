@@ -0,0 +1,281 @@
+/*
+	Problema de las monedas
+
+	Implementación con programación dinámica (vector) con existencias limitadas de cada moneda
+
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
+	Universidad Complutense de Madrid
+
+	Beatriz Herguedas Pinedo
+*/
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "Celdas.h"
+#include "Monedas.h"
+
+using namespace std;
+
+/*
+  Función que aplica un tipo de moneda con existencias limitadas al vector de la recursión
+
+  Recibe como parámetros:
+  monedas, que es el vector de la recursión (con las monedas anteriores ya aplicadas)
+  tomadas, donde escribimos cuántas monedas de este tipo cogemos para cada cantidad (nulo si no hace falta)
+  valor, que es el valor de la moneda
+  limite, que es el número de monedas de este tipo que tenemos
+  C, que es la cantidad que queremos alcanzar
+  posiciones y claves, memoria para las colas (al menos C + 1 + min(valor, C + 1) enteros cada una)
+  primeros y ultimos, memoria para los extremos de las colas (al menos min(valor, C + 1) enteros cada una)
+
+  Las cantidades j = r + t * valor con el mismo resto r solo dependen unas de otras. Si cogemos t - s monedas,
+  venimos de la cantidad r + s * valor, así que el nuevo valor es
+      monedas[j] = t + min(monedas[r + s * valor] - s) con t - limite <= s <= t
+  que es el mínimo de una ventana deslizante de anchura limite + 1. Lo calculamos con una cola monótona: guardamos
+  las s de la ventana con claves crecientes, de modo que el mínimo es siempre la primera, y cada s entra y sale
+  de la cola una sola vez. Así cada moneda cuesta O(C) sea cual sea su límite, en vez de O(C * limite)
+
+  La cola guarda las claves antiguas, así que podemos sobrescribir monedas[j] en cuanto hemos metido la suya.
+  Recorremos el vector en orden, con una cola para cada resto, en vez de resto por resto, porque saltar de valor
+  en valor por el vector falla en la caché en casi todos los accesos cuando la moneda es grande
+*/
+template <typename T>
+static void pasadaLimitada(T *monedas, T *tomadas, int valor, int limite, int C, int *posiciones, int *claves,
+	int *primeros, int *ultimos) {
+
+	// La cola del resto r ocupa las posiciones [r * largo, (r + 1) * largo)
+	int largo = C / valor + 1;
+	for (int r = 0; r < valor && r < C + 1; r++)
+		primeros[r] = ultimos[r] = r * largo;
+
+	for (int t = 0, b = 0; b < C + 1; t++, b += valor) {
+		for (int r = 0, j = b; r < valor && j < C + 1; r++, j++) {
+			int primero = primeros[r], ultimo = ultimos[r];
+
+			// Metemos la s = t, quitando del final las que ya no pueden ser el mínimo
+			if (monedas[j] != infinito<T>()) {
+				int clave = (int)monedas[j] - t;
+				while (ultimo > primero && claves[ultimo - 1] >= clave)
+					ultimo--;
+				posiciones[ultimo] = t;
+				claves[ultimo] = clave;
+				ultimo++;
+			}
+
+			// Sacamos del principio las que se han quedado fuera de la ventana (harían falta más de limite monedas)
+			while (ultimo > primero && posiciones[primero] < t - limite)
+				primero++;
+
+			if (ultimo > primero) {
+				monedas[j] = claves[primero] + t;
+				if (tomadas != nullptr)
+					tomadas[j] = t - posiciones[primero];
+			}
+			else {
+				monedas[j] = infinito<T>();
+				if (tomadas != nullptr)
+					tomadas[j] = 0;
+			}
+			primeros[r] = primero;
+			ultimos[r] = ultimo;
+		}
+	}
+}
+
+// Comprueba que hay un límite para cada tipo de moneda
+static void comprobarLimites(vector<int> const &v, vector<int> const &limites) {
+	if (limites.size() != v.size())
+		throw invalid_argument("monedasPDLimitada: tiene que haber un límite para cada tipo de moneda");
+}
+
+// Número de restos distintos de las colas de pasadaLimitada (como mucho C + 1)
+static int numRestos(vector<int> const &v, int C) {
+	return v.empty() ? 0 : min(*max_element(v.begin(), v.end()), C + 1);
+}
+
+// Enteros de memoria que necesitan las colas de rellenarLimitada: entre todas tienen menos de C + 1 + restos
+static size_t memoriaColas(vector<int> const &v, int C) {
+	size_t restos = numRestos(v, C);
+	return 2 * ((size_t)C + 1 + restos) + 2 * restos;
+}
+
+/*
+  Función que rellena el vector monedas[0..C] aplicando las monedas una detrás de otra con pasadaLimitada
+
+  Si tomadas no es nulo, escribe en la fila i (de C + 1 celdas) cuántas monedas del tipo v[i] se cogen para
+  cada cantidad. Sin tomadas la memoria es O(C), como en monedasPDVector. colas tiene que tener sitio para
+  memoriaColas(v, C) enteros
+*/
+template <typename T>
+static void rellenarLimitada(vector<int> const &v, int const *limites, int C, T *monedas, T *tomadas, int *colas) {
+
+	// Guardamos en N el número de tipos de moneda que tenemos
+	int N = v.size();
+
+	// CASOS BASE
+	// Inicializamos la primera pos a 0 y el resto a infinito
+	fill(monedas, monedas + C + 1, infinito<T>());
+	monedas[0] = 0;
+
+	// Repartimos la memoria de las colas de cada resto
+	int restos = numRestos(v, C);
+	int *posiciones = colas;
+	int *claves = posiciones + (size_t)C + 1 + restos;
+	int *primeros = claves + (size_t)C + 1 + restos;
+	int *ultimos = primeros + restos;
+
+	// RECURSIÓN
+	for (int i = 0; i < N; i++)
+		pasadaLimitada(monedas, tomadas != nullptr ? tomadas + (size_t)i * (C + 1) : nullptr, v[i], max(0, limites[i]), C,
+			posiciones, claves, primeros, ultimos);
+}
+
+/*
+  Función que reconstruye el desglose de num monedas recorriendo los tipos al revés y quitando las monedas que
+  hemos cogido de cada uno. Escribe en cuantas[i] cuántas monedas del tipo v[i] hemos usado (todas 0 si num es
+  INT_MAX)
+*/
+template <typename T>
+static void reconstruirLimitada(vector<int> const &v, int C, T const *tomadas, int num, int *cuantas) {
+	int N = v.size();
+	fill(cuantas, cuantas + N, 0);
+	if (num == INT_MAX)
+		return;
+	int j = C;
+	for (int i = N - 1; i >= 0; i--) {
+		cuantas[i] = tomadas[(size_t)i * (C + 1) + j];
+		j -= cuantas[i] * v[i];
+	}
+}
+
+/*
+  Función que resuelve el problema de las monedas con programación dinámica,
+  teniendo en cuenta las hipótesis necesarias:
+  1. Cantidad de monedas disponible de cada tipo limitada
+  2. El número de tipos de monedas sea finito
+
+  Recibe como parámetros:
+  v, que es el vector que contiene los tipos de monedas
+  limites, que es el vector con cuántas monedas del tipo v[i] tenemos (lanza invalid_argument si no tiene
+  el mismo tamaño que v)
+  C, que es la cantidad que queremos alcanzar
+  totalutilizadas, que es el número total de monedas que utilizamos
+
+  Como en monedasPDVector, la recursión se hace sobre un único vector monedas[0..C] al que aplicamos las monedas
+  una detrás de otra, pero cada moneda se aplica con pasadaLimitada, así que el tiempo total es O(N * C).
+  Para reconstruir la solución guardamos además, para cada tipo y cantidad, cuántas monedas de ese tipo hemos
+  cogido, así que la memoria es O(N * C), como la de monedasPDMatriz. Si solo hace falta el número de monedas,
+  monedasPDLimitadaTotal no guarda esa tabla y usa memoria O(C)
+
+  La función devuelve un par con el número mínimo de monedas necesario para resolver el problema (INT_MAX si no
+  se puede alcanzar C con las monedas que tenemos) y el vector que contiene cuántas monedas del tipo v[i]
+  hemos utilizado para ello (cuantas[i] para el tipo v[i - 1], como en monedasPDVector)
+
+  Cada celda es de tipo T (uint8_t, uint16_t o uint32_t), que debe ser lo bastante ancho para que la solución
+  no llegue a infinito<T>()
+*/
+template <typename T>
+pair<int, vector<int>> monedasPDLimitada(vector<int> const &v, vector<int> const &limites, int C, int &totalutilizados) {
+
+	comprobarLimites(v, limites);
+
+	// Guardamos en N el número de tipos de moneda que tenemos
+	int N = v.size();
+
+	// Creamos el vector de la recursión y la tabla de cuántas monedas del tipo v[i] cogemos, una fila por tipo
+	vector<T> monedas(C + 1);
+	vector<T> tomadas((size_t)N * (C + 1), 0);
+	vector<int> colas(memoriaColas(v, C));
+	rellenarLimitada(v, limites.data(), C, monedas.data(), tomadas.data(), colas.data());
+
+	// Al final, la solución se encuentra en la última pos del vector, por lo que la guardo en mi variable num
+	int num = monedas[C] == infinito<T>() ? INT_MAX : monedas[C];
+
+	/////////////////////////////////////////////////////////////////////////////
+	// Ahora vamos a reconstruir la solución
+
+	vector<int> cuantas(N + 1, 0);
+	reconstruirLimitada(v, C, tomadas.data(), num, cuantas.data() + 1);
+
+	// Sumamos al número total de monedas utilizado las de la solución
+	if (num != INT_MAX)
+		totalutilizados += num;
+
+	// Devolvemos el número total de monedas utilizadas y cuántas del tipo v[i] hemos usado
+	return { num, cuantas };
+}
+
+template pair<int, vector<int>> monedasPDLimitada<uint8_t>(vector<int> const &v, vector<int> const &limites, int C, int &totalutilizados);
+template pair<int, vector<int>> monedasPDLimitada<uint16_t>(vector<int> const &v, vector<int> const &limites, int C, int &totalutilizados);
+template pair<int, vector<int>> monedasPDLimitada<uint32_t>(vector<int> const &v, vector<int> const &limites, int C, int &totalutilizados);
+
+/*
+  Función que resuelve el problema con el tipo de celda más estrecho posible según la cota
+  del número de monedas (C dividido entre la moneda más pequeña), que también acota cuántas cogemos de cada tipo
+*/
+pair<int, vector<int>> monedasPDLimitada(vector<int> const &v, vector<int> const &limites, int C, int &totalutilizados) {
+	return segunCelda(cotaMonedas(v, C), [&](auto celda) {
+		return monedasPDLimitada<decltype(celda)>(v, limites, C, totalutilizados);
+	});
+}
+
+/*
+  Función que calcula solo el número mínimo de monedas con existencias limitadas (INT_MAX si no se puede
+  alcanzar C), sin la tabla del desglose, en tiempo O(N * C) y memoria O(C)
+*/
+int monedasPDLimitadaTotal(vector<int> const &v, vector<int> const &limites, int C) {
+	comprobarLimites(v, limites);
+	return segunCelda(cotaMonedas(v, C), [&](auto celda) {
+		using T = decltype(celda);
+		vector<T> monedas(C + 1);
+		vector<int> colas(memoriaColas(v, C));
+		rellenarLimitada(v, limites.data(), C, monedas.data(), (T *)nullptr, colas.data());
+		return monedas[C] == infinito<T>() ? INT_MAX : (int)monedas[C];
+	});
+}
+
+/*
+  Adaptador de monedasPDLimitada a la interfaz común
+
+  La interfaz común no tiene existencias, así que le damos C / M[i] monedas de cada tipo, que son todas las que
+  se pueden llegar a usar: el resultado es el del problema original y sirve para comparar su coste con PDVector
+*/
+Resultado resolverPDLimitada(vector<int> const &M, int C) {
+	Resultado r;
+	vector<int> limites(M.size());
+	for (size_t i = 0; i < M.size(); ++i)
+		limites[i] = C / M[i];
+	int totalutilizados = 0;
+	auto sol = monedasPDLimitada(M, limites, C, totalutilizados);
+	r.total = sol.first;
+	r.cuantas.assign(sol.second.begin() + 1, sol.second.end());
+	return r;
+}
+
+/*
+  Versión de resolverPDLimitada sin reservas de memoria: los límites, el vector de la recursión, la tabla de
+  cuántas monedas cogemos y las colas son bloques del espacio de trabajo, y el desglose se escribe directamente
+  en cuantas
+*/
+int resolverPDLimitadaSinReservas(vector<int> const &M, int C, Espacio &espacio, int *cuantas) {
+	int N = M.size();
+	int *limites = espacio.pedir<int>(N, 0);
+	for (int i = 0; i < N; ++i)
+		limites[i] = C / M[i];
+	int *colas = espacio.pedir<int>(memoriaColas(M, C), 1);
+	return segunCelda(cotaMonedas(M, C), [&](auto celda) {
+		using T = decltype(celda);
+		T *monedas = espacio.pedir<T>(C + 1, 2);
+		T *tomadas = espacio.pedir<T>((size_t)N * (C + 1), 3);
+		rellenarLimitada(M, limites, C, monedas, tomadas, colas);
+		int num = monedas[C] == infinito<T>() ? INT_MAX : (int)monedas[C];
+		if (cuantas != nullptr)
+			reconstruirLimitada(M, C, (T const *)tomadas, num, cuantas);
+		return num;
+	});
+}
@@ -1,10 +1,10 @@
 /*
 	Problema de las monedas
 
-	Implementacin con programacin dinmica (matriz)
+	Implementación con programación dinámica (matriz)
 
-	Mtodos algortmicos en Resolucin de Problemas
-	Facultad de Informtica
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
 	Universidad Complutense de Madrid
 
 	Beatriz Herguedas Pinedo
@@ -12,241 +12,199 @@
 
 #include <algorithm>
 #include <climits>
-#include <cmath>
-#include <ctime>
-#include <fstream>
-#include <iomanip>
-#include <iostream>
-#include <stdio.h>
-#include <stdlib.h> 
-#include <time.h>
-#include <unordered_map>
+#include <cstdint>
 #include <vector>
 
 #include "Matriz.h"
 
-using namespace std;
-
-// Constantes que indican el intervalo del nmero de iteraciones del bucle
-int const IT_MIN = 1000;
-int const IT_MAX = 4000;
+#include "Celdas.h"
+#include "Monedas.h"
 
-// De cunto en cunto se va iterando el bucle
-int const SUMA = 200;
-
-// Constantes que indican el intervalo en el que queremos que se mueva el random
-int const RA_MIN = 1;
-int const RA_MAX = 2;
+using namespace std;
 
 /*
-  Funcin que resuelve el problema de las monedas con programacin dinmica,
-  teniendo en cuenta las hiptesis necesarias:
+  Función que resuelve el problema de las monedas con programación dinámica,
+  teniendo en cuenta las hipótesis necesarias:
   1. Cantidad de monedas disponible de cada tipo ilimitada
-  2. El nmero de tipos de monedas sea finito
+  2. El número de tipos de monedas sea finito
 
-  Recibe como parmetros:
+  Recibe como parámetros:
   v, que es el vector que contiene los tipos de monedas
   C, que es la cantidad que queremos alcanzar
-  totalutilizadas, que es el nmero total de monedas que utilizamos
+  totalutilizadas, que es el número total de monedas que utilizamos
 
-  El algoritmo consiste en, partiendo de unos casos base y basndonos en los casos anteriores, calcular
-  la solucin ptima, utilizando para ello la recursin
+  El algoritmo consiste en, partiendo de unos casos base y basándonos en los casos anteriores, calcular
+  la solución óptima, utilizando para ello la recursión
 
-  La funcin devuelve un par con el nmero mnimo de monedas necesario para resolver el problema
-  y el vector que contiene cuntas monedas del tipo v[i] hemos utilizado para ello
+  La función devuelve un par con el número mínimo de monedas necesario para resolver el problema
+  y el vector que contiene cuántas monedas del tipo v[i] hemos utilizado para ello
+
+  Cada celda de la matriz es de tipo T (uint8_t, uint16_t o uint32_t), que debe ser lo bastante ancho
+  para que la solución no llegue a infinito<T>()
 */
-pair<int, vector<int>> monedas(vector<int> const &v, int C, int &totalutilizados){
+template <typename T>
+pair<int, vector<int>> monedasPDMatriz(vector<int> const &v, int C, int &totalutilizados){
 
-	// Creamos la variable que almacena el mnimo nmero de monedas y lo inicializamos a infinito
+	// Creamos la variable que almacena el mínimo número de monedas y lo inicializamos a infinito
 	int num = INT_MAX;
 
-	// Guardamos en N el nmero de tipos de moneda que tenemos
+	// Guardamos en N el número de tipos de moneda que tenemos
 	int N = v.size();
 
-	// Creamos la matriz que utilizaremos para almacenar los datos en la recursin
-	Matriz <int> M(N + 1, C + 1);
+	// Creamos la matriz que utilizaremos para almacenar los datos en la recursión
+	Matriz <T> M(N + 1, C + 1);
 
 	// CASOS BASE
 	// Inicializamos los casos base: la primera fila a infinito
 	// y la primera columna a 0 (esto se inicializa directamente al crear la matriz)
 	for (int j = 1; j < C + 1; ++j) {
-		M[0][j] = INT_MAX;
+		M[0][j] = infinito<T>();
 	}
 
-	// RECURSIN
+	// RECURSIÓN
 	// Recorremos toda la matriz desde la pos (0, 0) hasta la (N, C)
 	for (int i = 1; i < N + 1; i++) {
 		for (int j = 1; j < C + 1; j++) {
 
-			// Si la moneda que quiero usar es ms grande que la cantidad que quiero sumar,
-			// no la sumo y me quedo con la solucin ptima que tenia antes
-			if (v[i - 1] > j || M[i][j - v[i - 1]] == INT_MAX)
+			// Si la moneda que quiero usar es más grande que la cantidad que quiero sumar,
+			// no la sumo y me quedo con la solución óptima que tenia antes
+			if (v[i - 1] > j || M[i][j - v[i - 1]] == infinito<T>())
 				M[i][j] = M[i - 1][j];
 
-			// Si s que puedo sumar la moneda, me quedo con el mnimo de monedas que necesito
-			// entre las que necesito si la cojo y las que tena antes (sin cogerla)
+			// Si sí que puedo sumar la moneda, me quedo con el mínimo de monedas que necesito
+			// entre las que necesito si la cojo y las que tenía antes (sin cogerla)
 			else
-				M[i][j] = min(M[i - 1][j], M[i][j - v[i - 1]] + 1);
+				M[i][j] = min<T>(M[i - 1][j], M[i][j - v[i - 1]] + 1);
 		}
 	}
 
-	// Al final, la solucin se encuentra en la ltima pos de la matriz, por lo que la guardo en mi variable num
-	num = M[N][C];
+	// Al final, la solución se encuentra en la última pos de la matriz, por lo que la guardo en mi variable num
+	num = M[N][C] == infinito<T>() ? INT_MAX : M[N][C];
 
 	/////////////////////////////////////////////////////////////////////////////
-	// Ahora vamos a reconstruir la solucin
+	// Ahora vamos a reconstruir la solución
 
-	// Creamos el vector que va a almacenar cuntas monedas del tipo v[i] hemos utilizado
+	// Creamos el vector que va a almacenar cuántas monedas del tipo v[i] hemos utilizado
 	vector<int> cuantas(N + 1);
 
-	// Si hemos encontrado solucin (hay problemas que no la tienen)
+	// Si hemos encontrado solución (hay problemas que no la tienen)
 	if (num != INT_MAX) {
 
-		// Inicializamos las variables al mximo para recorrer la matriz al revs
+		// Inicializamos las variables al máximo para recorrer la matriz al revés
 		int i = N;
 		int j = C;
 
 		// Mientras no hayamos terminado de recorrer las columnas
 		while (j > 0) {
 
-			// Si hemos cogido la moneda que est en M[i][j], moneda del tipo v[i]
+			// Si hemos cogido la moneda que está en M[i][j], moneda del tipo v[i]
 			if (v[i - 1] < j + 1 && M[i][j] != M[i - 1][j]) {
 
-				// Sumamos 1 al nmero de monedas de dicho tipo que hemos utilizado
+				// Sumamos 1 al número de monedas de dicho tipo que hemos utilizado
 				cuantas[i]++;
 
-				// Sumamos 1 al nmero total de monedas utilizado
+				// Sumamos 1 al número total de monedas utilizado
 				totalutilizados++;
 
 				// Voy al sitio "del que vengo" al haber cogido la moneda en M[i][j]
 				j -= v[i - 1];
 			}
 
-			// Si ya no cogemos ms monedas del tipo v[i]
+			// Si ya no cogemos más monedas del tipo v[i]
 			else {
 				i--;
 			}
 		}
 	}
 
-	// Devolvemos el nmero total de monedas utilizadas y cuntas del tipo v[i] hemos usado
+	// Devolvemos el número total de monedas utilizadas y cuántas del tipo v[i] hemos usado
 	return { num, cuantas };
 }
 
-void prueba(int N, ofstream &salida, ofstream &salidaGraficarX, ofstream &salidaGraficarY) {
-
-	// Generamos la semilla del random en funcin del tiempo
-	srand(time(NULL));
-
-	// Creamos nuestra moneda
-	int valorMoneda;
+template pair<int, vector<int>> monedasPDMatriz<uint8_t>(vector<int> const &v, int C, int &totalutilizados);
+template pair<int, vector<int>> monedasPDMatriz<uint16_t>(vector<int> const &v, int C, int &totalutilizados);
+template pair<int, vector<int>> monedasPDMatriz<uint32_t>(vector<int> const &v, int C, int &totalutilizados);
 
-	// Creamos el vector que va a almacenar los tipos de monedas
-	vector<int> tiposMonedas;
-
-	// Creamos un mapa para llevar la cuenta de los tipos de moneda que introducimos (para no admitir repetidos)
-	unordered_map <int, bool> norepes;
-
-	// Recorremos el vector insertando los tipos de monedas
-	for (int i = 1; i <= N; ++i) {
-
-		// Le damos un valor aleatorio (entre 1 y 4 * N) a la moneda que vamos a insertar
-		valorMoneda = 1 + rand() % (4 * N);
-
-		// Mientras la moneda que hemos generado ya est entre las que tenamos, seguimos generando otra de manera aleatoria
-		while (norepes.count(valorMoneda))
-			valorMoneda = 1 + rand() % (4 * N);
-
-		// Cuando ya sabemos seguro que la moneda no est entre las que tenamos, la insertamos
-		// tanto en el diccionario donde llevamos las insertadas como en el vector que almacena los tipos de moneda
-		norepes.insert({valorMoneda, true});
-		tiposMonedas.push_back(valorMoneda);
-	}
-
-	// Le damos un valor a C, que es la cantidad que queremos alcanzar para resolver el problema
-	// En este caso el valor elegido es 2 * N
-	int C = 2 * N;
-
-	// Inicializamos el nmero total de monedas utilizadas a 0
-	int totalutilizadas = 0;
+/*
+  Función que resuelve el problema con el tipo de celda más estrecho posible según la cota
+  del número de monedas (C dividido entre la moneda más pequeña)
+*/
+pair<int, vector<int>> monedasPDMatriz(vector<int> const &v, int C, int &totalutilizados) {
+	return segunCelda(cotaMonedas(v, C), [&](auto celda) {
+		return monedasPDMatriz<decltype(celda)>(v, C, totalutilizados);
+	});
+}
 
-	// Nos guardamos el tiempo justo antes de realizar la prueba
-	int t0 = clock();
 
-	// Realizamos la prueba llamando a la funcin que calcula la solucin y guardndola en el par sol
-	auto sol = monedas(tiposMonedas, C, totalutilizadas);
+/*
+  Adaptador de monedasPDMatriz a la interfaz común
 
-	// Nos guardamos el tiempo justo al terminar la prueba
-	int t1 = clock();
+  La función original devuelve cuantas[i] para el tipo v[i - 1], así que lo desplazamos una posición
+*/
+Resultado resolverPDMatriz(vector<int> const &M, int C) {
+	Resultado r;
+	int totalutilizados = 0;
+	auto sol = monedasPDMatriz(M, C, totalutilizados);
+	r.total = sol.first;
+	r.cuantas.assign(sol.second.begin() + 1, sol.second.end());
+	return r;
+}
 
-	// Calculamos el tiempo que ha durado la prueba restando el inicial al final
-	double tiempo = double(t1 - t0) / CLOCKS_PER_SEC;
+/*
+  Versión de monedasPDMatriz sin reservas de memoria
 
-	/////////////////////////////////////////////////////////////////////////////
-	// Ahora escribimos en los archivos
+  La matriz es un bloque del espacio de trabajo guardado por filas (la celda (i, j) está en la posición
+  i * (C + 1) + j), y la solución se escribe directamente en cuantas. La recursión y la reconstrucción son
+  las mismas que en monedasPDMatriz
+*/
+template <typename T>
+static int monedasPDMatrizSinReservas(vector<int> const &v, int C, T *M, int *cuantas) {
+	int N = v.size();
+	long long fila = C + 1;
 
-	// Primero en salida
-	salida << "Nmero de tipos de monedas que tenemos: " << N << '\n';
-	salida << "Queremos alcanzar la cantidad " << C << '\n';
-	salida << "Cantidad total de monedas utilizadas: " << totalutilizadas << '\n';
+	// CASOS BASE
+	M[0] = 0;
+	for (int j = 1; j < C + 1; ++j)
+		M[j] = infinito<T>();
+	for (int i = 1; i < N + 1; ++i)
+		M[i * fila] = 0;
 
-	salida << "Hemos cogido ";
-	for (auto i : sol.second) {
-		if (sol.second[i] > 0)
-			salida << sol.second[i] << " monedas del tipo " << tiposMonedas[i - 1] << '\n';
+	// RECURSIÓN
+	for (int i = 1; i < N + 1; i++) {
+		T *actual = M + i * fila;
+		T const *anterior = M + (i - 1) * fila;
+		for (int j = 1; j < C + 1; j++) {
+			if (v[i - 1] > j || actual[j - v[i - 1]] == infinito<T>())
+				actual[j] = anterior[j];
+			else
+				actual[j] = min<T>(anterior[j], actual[j - v[i - 1]] + 1);
+		}
 	}
 
-	salida << "Tiempo requerido = " << tiempo << " segundos" << '\n';
-	salida << "--------------------------\n";
-
-	// Despus en grficaX
-	salidaGraficarX << N << '\n';
+	int num = M[N * fila + C] == infinito<T>() ? INT_MAX : M[N * fila + C];
 
-	// Y por ltimo en grficaY
-	salidaGraficarY << fixed;
-	salidaGraficarY << setprecision(3) << tiempo << '\n';
-
-	/////////////////////////////////////////////////////////////////////////////
-
-	// Sacamos por pantalla el nmero de tipos
-	cout << "N = " << N << '\n';
-
-	// Cuntas de cada tipo
-	for (auto i : sol.second) {
-		if (sol.second[i] > 0)
-			salida << sol.second[i] << " " << tiposMonedas[i - 1] << '\n';
+	// Reconstruimos la solución
+	if (cuantas != nullptr) {
+		fill(cuantas, cuantas + N, 0);
+		int i = N;
+		int j = C;
+		while (num != INT_MAX && j > 0) {
+			if (v[i - 1] < j + 1 && M[i * fila + j] != M[(i - 1) * fila + j]) {
+				cuantas[i - 1]++;
+				j -= v[i - 1];
+			}
+			else
+				i--;
+		}
 	}
 
-	// Y el tiempo requerido
-	cout << "Tiempo requerido = " << tiempo << " segundos" << '\n';
+	return num;
 }
 
-/*
-  Funcin que escribe en los ficheros
-
-  - El fichero "SalidaPDMatriz" contiene la salida con toda la informacin
-  - El fichero "GraficaXPDMatriz" contiene tan solo informacin de los tamaos de cara a pintar la grfica
-  - El fichero "GraficaYPDMatriz" contiene tan solo informacin de los tiempos de cara a pintar la grfica
-*/
-void fichero() {
-
-	// Creamos los ficheros
-	ofstream salida("SalidaPDMatriz.txt");
-	ofstream salidaGraficarX("GraficaXPDMatriz.txt");
-	ofstream salidaGraficarY("GraficaYPDMatriz.txt");
-
-	// Hacemos las pruebas en el intervalo de iteraciones decidido
-	for (int i = IT_MIN; i < IT_MAX + 1; i = i + SUMA)
-		prueba(i, salida, salidaGraficarX, salidaGraficarY);
-
-	// Cerramos los ficheros
-	salida.close();
-	salidaGraficarX.close();
-	salidaGraficarY.close();
+int resolverPDMatrizSinReservas(vector<int> const &M, int C, Espacio &espacio, int *cuantas) {
+	return segunCelda(cotaMonedas(M, C), [&](auto celda) {
+		using T = decltype(celda);
+		T *tabla = espacio.pedir<T>((M.size() + 1) * (size_t(C) + 1));
+		return monedasPDMatrizSinReservas(M, C, tabla, cuantas);
+	});
 }
-
-int main() {
-	fichero();
-	system("pause");
-	return 0;
-}
\ No newline at end of file
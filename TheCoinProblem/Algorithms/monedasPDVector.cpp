@@ -1,251 +1,506 @@
 /*
 	Problema de las monedas
 
-	Implementacin con programacin dinmica (vector)
+	Implementación con programación dinámica (vector)
 
-	Mtodos algortmicos en Resolucin de Problemas
-	Facultad de Informtica
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
 	Universidad Complutense de Madrid
 
 	Beatriz Herguedas Pinedo
 */
 
 #include <algorithm>
+#include <atomic>
 #include <climits>
-#include <cmath>
-#include <ctime>
-#include <fstream>
-#include <iomanip>
-#include <iostream>
-#include <stdio.h>
-#include <stdlib.h> 
-#include <time.h>
-#include <unordered_map>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
 #include <vector>
 
-#include "Matriz.h"
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+#include "Celdas.h"
+#include "Monedas.h"
 
 using namespace std;
 
-// Constantes que indican el intervalo del nmero de iteraciones del bucle
-int const IT_MIN = 10;
-int const IT_MAX = 15;
+// Tamaño en bytes de cada bloque (128 KB, para que el bloque quepa en la caché L2)
+int const BLOQUE_BYTES = 1 << 17;
 
-// De cunto en cunto se va iterando el bucle
-int const SUMA = 1;
+// Anchura mínima de las ventanas (la moneda más pequeña) para que compense repartirlas entre los hilos
+int const VENTANA_MINIMA = 4096;
 
-// Constantes que indican el intervalo en el que queremos que se mueva el random
-int const RA_MIN = 1;
-int const RA_MAX = 2;
+// Trabajo mínimo (número de monedas por C) para que compense crear los hilos en resolverPDParalelo
+long long const TRABAJO_MINIMO_PARALELO = 1 << 22;
 
 /*
-  Funcin que resuelve el problema de las monedas con programacin dinmica,
-  teniendo en cuenta las hiptesis necesarias:
-  1. Cantidad de monedas disponible de cada tipo ilimitada
-  2. El nmero de tipos de monedas sea finito
-
-  Recibe como parmetros:
-  v, que es el vector que contiene los tipos de monedas
-  C, que es la cantidad que queremos alcanzar
-  totalutilizadas, que es el nmero total de monedas que utilizamos
-
-  El algoritmo consiste en, partiendo de unos casos base y basndonos en los casos anteriores, calcular
-  la solucin ptima, utilizando para ello la recursin
+  Operaciones vectoriales para cada tipo de celda: sumar y quedarse con el mínimo sin signo
 
-  La funcin devuelve un par con el nmero mnimo de monedas necesario para resolver el problema
-  y el vector que contiene cuntas monedas del tipo v[i] hemos utilizado para ello
+  Con AVX2 se procesan 32 celdas de 1 byte, 16 de 2 bytes u 8 de 4 bytes por instrucción,
+  y el doble con AVX-512 (las celdas de 1 y 2 bytes necesitan AVX-512BW)
 */
-pair<int, vector<int>> monedas(vector<int> const &v, int C, int &totalutilizados) {
+template <typename T>
+struct Vectorial256 {
+	static bool const disponible = false;
+};
+
+template <typename T>
+struct Vectorial512 {
+	static bool const disponible = false;
+};
+
+#if defined(__AVX2__)
+template <>
+struct Vectorial256<uint8_t> {
+	static bool const disponible = true;
+	static __m256i uno() { return _mm256_set1_epi8(1); }
+	static __m256i sumar(__m256i a, __m256i b) { return _mm256_add_epi8(a, b); }
+	static __m256i minimo(__m256i a, __m256i b) { return _mm256_min_epu8(a, b); }
+};
+
+template <>
+struct Vectorial256<uint16_t> {
+	static bool const disponible = true;
+	static __m256i uno() { return _mm256_set1_epi16(1); }
+	static __m256i sumar(__m256i a, __m256i b) { return _mm256_add_epi16(a, b); }
+	static __m256i minimo(__m256i a, __m256i b) { return _mm256_min_epu16(a, b); }
+};
+
+template <>
+struct Vectorial256<uint32_t> {
+	static bool const disponible = true;
+	static __m256i uno() { return _mm256_set1_epi32(1); }
+	static __m256i sumar(__m256i a, __m256i b) { return _mm256_add_epi32(a, b); }
+	static __m256i minimo(__m256i a, __m256i b) { return _mm256_min_epu32(a, b); }
+};
+#endif
+
+#if defined(__AVX512BW__)
+template <>
+struct Vectorial512<uint8_t> {
+	static bool const disponible = true;
+	static __m512i uno() { return _mm512_set1_epi8(1); }
+	static __m512i sumar(__m512i a, __m512i b) { return _mm512_add_epi8(a, b); }
+	static __m512i minimo(__m512i a, __m512i b) { return _mm512_min_epu8(a, b); }
+};
+
+template <>
+struct Vectorial512<uint16_t> {
+	static bool const disponible = true;
+	static __m512i uno() { return _mm512_set1_epi16(1); }
+	static __m512i sumar(__m512i a, __m512i b) { return _mm512_add_epi16(a, b); }
+	static __m512i minimo(__m512i a, __m512i b) { return _mm512_min_epu16(a, b); }
+};
+#endif
+
+#if defined(__AVX512F__)
+template <>
+struct Vectorial512<uint32_t> {
+	static bool const disponible = true;
+	static __m512i uno() { return _mm512_set1_epi32(1); }
+	static __m512i sumar(__m512i a, __m512i b) { return _mm512_add_epi32(a, b); }
+	static __m512i minimo(__m512i a, __m512i b) { return _mm512_min_epu32(a, b); }
+};
+#endif
 
-	// Creamos la variable que almacena el mnimo nmero de monedas y lo inicializamos a infinito
-	int num = INT_MAX;
-
-	// Guardamos en N el nmero de tipos de moneda que tenemos
-	int N = v.size();
+/*
+  Función que aplica un tipo de moneda a un tramo del vector: monedas[j] = min(monedas[j], monedas[j - valor] + 1)
+  para j entre max(valor, desde) y hasta
 
-	// Creamos el vector que utilizaremos para almacenar los datos en la recursin
-	vector<int> monedas(C + 1);
+  Recibe como parámetros:
+  monedas, que es el vector de la recursión
+  valor, que es el valor de la moneda
+  desde y hasta, que son los extremos del tramo
 
-	// CASOS BASE
-	// Inicializamos los casos base: la primera pos a 0
-	monedas[0] = 0;
+  Cada posición j solo depende de j - valor, así que si la moneda vale al menos el ancho del registro vectorial,
+  las posiciones de un mismo registro no dependen unas de otras y se calculan todas con una sola instrucción.
+  Para monedas más pequeñas y para el final del vector se usa el bucle escalar
+*/
+template <typename T>
+static void pasadaMoneda(T *monedas, int valor, int desde, int hasta) {
+	int j = max(valor, desde);
+
+#if defined(__AVX512F__)
+	if constexpr (Vectorial512<T>::disponible) {
+		using V = Vectorial512<T>;
+		int const ancho = 64 / sizeof(T);
+		if (valor >= ancho) {
+			__m512i const uno = V::uno();
+			for (; j <= hasta - ancho + 1; j += ancho) {
+				__m512i con = V::sumar(_mm512_loadu_si512(monedas + j - valor), uno);
+				__m512i sin = _mm512_loadu_si512(monedas + j);
+				_mm512_storeu_si512(monedas + j, V::minimo(sin, con));
+			}
+		}
+	}
+#endif
+
+#if defined(__AVX2__)
+	if constexpr (Vectorial256<T>::disponible) {
+		using V = Vectorial256<T>;
+		int const ancho = 32 / sizeof(T);
+		if (valor >= ancho) {
+			__m256i const uno = V::uno();
+			for (; j <= hasta - ancho + 1; j += ancho) {
+				__m256i con = V::sumar(_mm256_loadu_si256((__m256i const *)(monedas + j - valor)), uno);
+				__m256i sin = _mm256_loadu_si256((__m256i const *)(monedas + j));
+				_mm256_storeu_si256((__m256i *)(monedas + j), V::minimo(sin, con));
+			}
+		}
+	}
+#endif
 
-	// y el resto a infinito
-	for (int j = 1; j < C + 1; j++)
-		monedas[j] = INT_MAX;
+	for (; j <= hasta; j++)
+		monedas[j] = min<T>(monedas[j], monedas[j - valor] + 1);
+}
 
-	// RECURSIN
-	// Recorremos toda la matriz desde la pos (0, 0) hasta la (N, C)
-	for (int i = 1; i < N + 1; i++) {
-		// la j empieza en v[i - 1] porque es el primer tipo de moneda menor que lo que nos falta
-		for (int j = v[i - 1]; j < C + 1; j++) {
+/*
+  Función que reconstruye la solución a partir del vector ya relleno
 
-			// Si puedo sumar la moneda, me quedo con el mnimo de monedas que necesito
-			// entre las que necesito si la cojo y las que tena antes (sin cogerla)
-			if (monedas[j - v[i - 1]] != INT_MAX)
-				monedas[j] = min(monedas[j], monedas[j - v[i - 1]] + 1);
+  Escribe en cuantas[i] cuántas monedas del tipo v[i] hemos utilizado (si cuantas no es nulo)
+  y devuelve el número mínimo de monedas (INT_MAX si no hay solución)
+*/
+template <typename T>
+static int reconstruir(vector<int> const &v, T const *monedas, int C, int *cuantas) {
 
-			else
-				monedas[j] = monedas[j];
-		}
-	}
+	// Guardamos en N el número de tipos de moneda que tenemos
+	int N = v.size();
 
-	// Al final, la solucin se encuentra en la ltima pos del vector, por lo que la guardo en mi variable num
-	num = monedas[C];
+	// Al final, la solución se encuentra en la última pos del vector, por lo que la guardo en mi variable num
+	int num = monedas[C] == infinito<T>() ? INT_MAX : monedas[C];
 
 	/////////////////////////////////////////////////////////////////////////////
-	// Ahora vamos a reconstruir la solucin
+	// Ahora vamos a reconstruir la solución
 
-	// Creamos el vector que va a almacenar cuntas monedas del tipo v[i] hemos utilizado
-	vector<int> cuantas(N + 1);
+	if (cuantas != nullptr)
+		fill(cuantas, cuantas + N, 0);
 
-	// Si hemos encontrado solucin (hay problemas que no la tienen)
-	if (num != INT_MAX) {
+	// Si hemos encontrado solución (hay problemas que no la tienen)
+	if (num != INT_MAX && cuantas != nullptr) {
 
-		// Inicializamos las variables al mximo para recorrer la matriz al revs
+		// Inicializamos las variables al máximo para recorrer la matriz al revés
 		int i = N;
 		int j = C;
 
 		// Mientras no hayamos terminado de recorrer las columnas
 		while (j > 0) {
 
-			// Si hemos cogido la moneda que est en M[i][j], moneda del tipo v[i]
+			// Si hemos cogido la moneda que está en M[i][j], moneda del tipo v[i]
 			if (v[i - 1] < j + 1 && monedas[j] == monedas[j - v[i - 1]] + 1) {
 
-				// Sumamos 1 al nmero de monedas de dicho tipo que hemos utilizado
-				cuantas[i]++;
-
-				// Sumamos 1 al nmero total de monedas utilizado
-				totalutilizados++;
+				// Sumamos 1 al número de monedas de dicho tipo que hemos utilizado
+				cuantas[i - 1]++;
 
 				// Voy al sitio "del que vengo" al haber cogido la moneda en M[i][j]
 				j -= v[i - 1];
 			}
 
-			// Si ya no cogemos ms monedas del tipo v[i]
+			// Si ya no cogemos más monedas del tipo v[i]
 			else
 				i--;
 		}
 	}
 
-	// Devolvemos el nmero total de monedas utilizadas y cuntas del tipo v[i] hemos usado
-	return { num, cuantas };
+	return num;
 }
 
-void prueba(int N, ofstream &salida, ofstream &salidaGraficarX, ofstream &salidaGraficarY) {
+/*
+  Función que reconstruye la solución a partir del vector ya relleno
 
-	// Generamos la semilla del random en funcin del tiempo
-	srand(time(NULL));
+  Devuelve el mismo par que monedasPDVector (cuantas[i] para el tipo v[i - 1])
+*/
+template <typename T>
+static pair<int, vector<int>> reconstruir(vector<int> const &v, vector<T> const &monedas, int C, int &totalutilizados) {
+	vector<int> cuantas(v.size() + 1);
+	int num = reconstruir(v, monedas.data(), C, cuantas.data() + 1);
 
-	// Creamos nuestra moneda
-	int valorMoneda;
+	// Sumamos al número total de monedas utilizado las de la solución
+	if (num != INT_MAX)
+		totalutilizados += num;
 
-	// Creamos el vector que va a almacenar los tipos de monedas
-	vector<int> tiposMonedas;
+	// Devolvemos el número total de monedas utilizadas y cuántas del tipo v[i] hemos usado
+	return { num, cuantas };
+}
 
-	// Creamos un mapa para llevar la cuenta de los tipos de moneda que introducimos (para no admitir repetidos)
-	unordered_map <int, bool> norepes;
+/*
+  Función que rellena el vector monedas[0..C] por bloques que caben en caché
 
-	// Recorremos el vector insertando los tipos de monedas
-	for (int i = 1; i <= N; ++i) {
+  Para cada moneda, me quedo con el mínimo de monedas que necesito entre las que necesito si la cojo y las que
+  tenía antes (sin cogerla). En vez de recorrer el vector entero una vez por cada moneda, lo recorremos por
+  bloques y aplicamos todas las monedas a un bloque antes de pasar al siguiente. La posición j solo lee
+  posiciones anteriores: las de bloques anteriores ya tienen su valor definitivo, y las del mismo bloque llevan
+  aplicadas las mismas monedas que en el recorrido completo, así que el resultado es el mismo
+*/
+template <typename T>
+static void rellenar(vector<int> const &v, T *monedas, int C) {
 
-		// Le damos un valor aleatorio (entre 1 y 4 * N) a la moneda que vamos a insertar
-		valorMoneda = 1 + rand() % (4 * N);
+	// Guardamos en N el número de tipos de moneda que tenemos
+	int N = v.size();
 
-		// Mientras la moneda que hemos generado ya est entre las que tenamos, seguimos generando otra de manera aleatoria
-		while (norepes.count(valorMoneda))
-			valorMoneda = 1 + rand() % (4 * N);
+	// CASOS BASE
+	// Inicializamos los casos base: la primera pos a 0
+	monedas[0] = 0;
 
-		// Cuando ya sabemos seguro que la moneda no est entre las que tenamos, la insertamos
-		// tanto en el diccionario donde llevamos las insertadas como en el vector que almacena los tipos de moneda
-		norepes.insert({ valorMoneda, true });
-		tiposMonedas.push_back(valorMoneda);
+	// y el resto a infinito
+	for (int j = 1; j < C + 1; j++)
+		monedas[j] = infinito<T>();
+
+	// RECURSIÓN
+	int const bloque = BLOQUE_BYTES / sizeof(T);
+	for (int b = 1; b < C + 1; b += bloque) {
+		int fin = min(C, b + bloque - 1);
+		for (int i = 1; i < N + 1; i++) {
+			// la j empieza en v[i - 1] porque es el primer tipo de moneda menor que lo que nos falta
+			if (v[i - 1] <= fin)
+				pasadaMoneda(monedas, v[i - 1], b, fin);
+		}
 	}
+}
 
-	// Le damos un valor a C, que es la cantidad que queremos alcanzar para resolver el problema
-	// En este caso el valor elegido es 2 * N
-	int C = 2 * N;
+/*
+  Función que resuelve el problema de las monedas con programación dinámica,
+  teniendo en cuenta las hipótesis necesarias:
+  1. Cantidad de monedas disponible de cada tipo ilimitada
+  2. El número de tipos de monedas sea finito
 
-	// Inicializamos el nmero total de monedas utilizadas a 0
-	int totalutilizadas = 0;
+  Recibe como parámetros:
+  v, que es el vector que contiene los tipos de monedas
+  C, que es la cantidad que queremos alcanzar
+  totalutilizadas, que es el número total de monedas que utilizamos
 
-	// Nos guardamos el tiempo justo antes de realizar la prueba
-	int t0 = clock();
+  El algoritmo consiste en, partiendo de unos casos base y basándonos en los casos anteriores, calcular
+  la solución óptima, utilizando para ello la recursión
 
-	// Realizamos la prueba llamando a la funcin que calcula la solucin y guardndola en el par sol
-	auto sol = monedas(tiposMonedas, C, totalutilizadas);
+  La función devuelve un par con el número mínimo de monedas necesario para resolver el problema
+  y el vector que contiene cuántas monedas del tipo v[i] hemos utilizado para ello
 
-	// Nos guardamos el tiempo justo al terminar la prueba
-	int t1 = clock();
+  Cada celda del vector es de tipo T (uint8_t, uint16_t o uint32_t), que debe ser lo bastante ancho
+  para que la solución no llegue a infinito<T>()
+*/
+template <typename T>
+pair<int, vector<int>> monedasPDVector(vector<int> const &v, int C, int &totalutilizados) {
 
-	// Calculamos el tiempo que ha durado la prueba restando el inicial al final
-	double tiempo = double(t1 - t0) / CLOCKS_PER_SEC;
+	// Creamos el vector que utilizaremos para almacenar los datos en la recursión
+	vector<T> monedas(C + 1);
+	rellenar(v, monedas.data(), C);
 
-	/////////////////////////////////////////////////////////////////////////////
-	// Ahora escribimos en los archivos
+	return reconstruir(v, monedas, C, totalutilizados);
+}
 
-	// Primero en salida
-	salida << "Nmero de tipos de monedas que tenemos: " << N << '\n';
-	salida << "Queremos alcanzar la cantidad " << C << '\n';
-	salida << "Cantidad total de monedas utilizadas: " << totalutilizadas << '\n';
+template pair<int, vector<int>> monedasPDVector<uint8_t>(vector<int> const &v, int C, int &totalutilizados);
+template pair<int, vector<int>> monedasPDVector<uint16_t>(vector<int> const &v, int C, int &totalutilizados);
+template pair<int, vector<int>> monedasPDVector<uint32_t>(vector<int> const &v, int C, int &totalutilizados);
 
-	salida << "Hemos cogido ";
-	for (auto i : sol.second) {
-		if (sol.second[i] > 0)
-			salida << sol.second[i] << " monedas del tipo " << tiposMonedas[i - 1] << '\n';
-	}
+/*
+  Función que resuelve el problema con el tipo de celda más estrecho posible según la cota
+  del número de monedas (C dividido entre la moneda más pequeña)
+*/
+pair<int, vector<int>> monedasPDVector(vector<int> const &v, int C, int &totalutilizados) {
+	return segunCelda(cotaMonedas(v, C), [&](auto celda) {
+		return monedasPDVector<decltype(celda)>(v, C, totalutilizados);
+	});
+}
 
-	salida << "Tiempo requerido = " << tiempo << " segundos" << '\n';
-	salida << "--------------------------\n";
 
-	// Despus en grficaX
-	salidaGraficarX << N << '\n';
+/////////////////////////////////////////////////////////////////////////////
+// Versión paralela
 
-	// Y por ltimo en grficaY
-	salidaGraficarY << fixed;
-	salidaGraficarY << setprecision(3) << tiempo << '\n';
+// Barrera para que todos los hilos terminen una ventana antes de empezar la siguiente
+class Barrera {
+public:
+	explicit Barrera(int hilos) : hilos(hilos), esperando(0), generacion(0) {}
 
-	/////////////////////////////////////////////////////////////////////////////
+	void esperar() {
+		unique_lock<mutex> lock(m);
+		int g = generacion;
+		if (++esperando == hilos) {
+			esperando = 0;
+			generacion++;
+			cv.notify_all();
+		}
+		else
+			cv.wait(lock, [&]() { return generacion != g; });
+	}
 
-	// Sacamos por pantalla el nmero de tipos
-	cout << "N = " << N << '\n';
+private:
+	mutex m;
+	condition_variable cv;
+	int hilos;
+	int esperando;
+	int generacion;
+};
 
-	// Cuntas de cada tipo
-	for (auto i : sol.second) {
-		if (sol.second[i] > 0)
-			salida << sol.second[i] << " " << tiposMonedas[i - 1] << '\n';
-	}
+/*
+  Función que rellena el vector por ventanas de la anchura de la moneda más pequeña
 
-	// Y el tiempo requerido
-	cout << "Tiempo requerido = " << tiempo << " segundos" << '\n';
+  Si la moneda más pequeña vale m, las cantidades de la ventana [b, b + m) solo dependen de cantidades menores
+  que b, que ya son definitivas. Así que cada hilo calcula un trozo de la ventana aplicando todas las monedas
+  (cada moneda con pasadaMoneda, que solo lee posiciones anteriores a b) y esperamos a que terminen todos
+  antes de pasar a la siguiente ventana
+*/
+template <typename T>
+static void rellenarPorVentanas(vector<int> const &v, vector<T> &monedas, int C, int hilos) {
+	int m = *min_element(v.begin(), v.end());
+	Barrera barrera(hilos);
+
+	auto trabajo = [&](int h) {
+		for (long long b = 1; b <= C; b += m) {
+			// Trozo de la ventana que le toca a este hilo
+			long long fin = min<long long>(C, b + m - 1);
+			long long ancho = fin - b + 1;
+			int desde = int(b + ancho * h / hilos);
+			int hasta = int(b + ancho * (h + 1) / hilos) - 1;
+
+			for (int valor : v) {
+				if (valor <= hasta && desde <= hasta)
+					pasadaMoneda(monedas.data(), valor, desde, hasta);
+			}
+			barrera.esperar();
+		}
+	};
+
+	vector<thread> trabajadores;
+	for (int h = 1; h < hilos; ++h)
+		trabajadores.emplace_back(trabajo, h);
+	trabajo(0);
+	for (auto &t : trabajadores)
+		t.join();
 }
 
 /*
-  Funcin que escribe en los ficheros
+  Función que rellena el vector en cadena, repartiendo las monedas entre los hilos (útil si la moneda
+  más pequeña es 1 y no hay ventanas que repartir)
+
+  Cada hilo se encarga de un grupo de monedas consecutivas y recorre el vector por bloques de al menos
+  el valor de la moneda más grande, como en la versión secuencial. El grupo g solo empieza el bloque k
+  cuando el grupo g - 1 ha terminado el bloque k + 1, así que:
+  - el bloque k ya tiene aplicadas las monedas de los grupos anteriores, y el k - 1 las de los grupos hasta g
+    (el grupo g + 1 como mucho va por el bloque k - 2), igual que en el recorrido secuencial
+  - ningún otro hilo escribe en los bloques k - 1 y k que lee el grupo g, así que no hay carreras
+*/
+template <typename T>
+static void rellenarEnCadena(vector<int> const &v, vector<T> &monedas, int C, int hilos) {
+	int N = v.size();
+	int grupos = min(hilos, N);
+	int bloque = max<int>(BLOQUE_BYTES / sizeof(T), *max_element(v.begin(), v.end()));
+	int numBloques = int((C + (long long)bloque - 1) / bloque);
+
+	// hechos[g], número de bloques que el grupo g ya ha terminado
+	vector<atomic<int>> hechos(grupos);
+	for (auto &h : hechos)
+		h.store(0);
+
+	auto trabajo = [&](int g) {
+		int primera = N * g / grupos;
+		int ultima = N * (g + 1) / grupos;
+		for (int k = 0; k < numBloques; ++k) {
+			// Esperamos a que el grupo anterior vaya dos bloques por delante (o haya terminado)
+			if (g > 0) {
+				int necesarios = min(k + 2, numBloques);
+				while (hechos[g - 1].load(memory_order_acquire) < necesarios)
+					this_thread::yield();
+			}
 
-  - El fichero "SalidaPDVector" contiene la salida con toda la informacin
-  - El fichero "GraficaXPDVector" contiene tan solo informacin de los tamaos de cara a pintar la grfica
-  - El fichero "GraficaYPDVector" contiene tan solo informacin de los tiempos de cara a pintar la grfica
+			int desde = 1 + k * bloque;
+			int hasta = (int)min<long long>(C, (long long)desde + bloque - 1);
+			for (int i = primera; i < ultima; ++i) {
+				if (v[i] <= hasta)
+					pasadaMoneda(monedas.data(), v[i], desde, hasta);
+			}
+			hechos[g].store(k + 1, memory_order_release);
+		}
+	};
+
+	vector<thread> trabajadores;
+	for (int g = 1; g < grupos; ++g)
+		trabajadores.emplace_back(trabajo, g);
+	trabajo(0);
+	for (auto &t : trabajadores)
+		t.join();
+}
+
+/*
+  Función que resuelve el problema igual que monedasPDVector pero repartiendo el trabajo entre varios hilos
+
+  Recibe además:
+  hilos, que es el número de hilos que vamos a usar
+
+  Si la moneda más pequeña es lo bastante grande se reparten las ventanas entre los hilos, y si no,
+  se reparten las monedas en cadena. El resultado es exactamente el mismo que el de monedasPDVector
 */
-void fichero() {
+template <typename T>
+pair<int, vector<int>> monedasPDVectorParalelo(vector<int> const &v, int C, int &totalutilizados, int hilos) {
+
+	// Elegimos el reparto antes de crear el vector, para no reservarlo si lo resuelve la versión secuencial
+	bool ventanas = hilos > 1 && !v.empty() && C > 0 && *min_element(v.begin(), v.end()) >= VENTANA_MINIMA;
+	bool cadena = !ventanas && hilos > 1 && v.size() > 1 && C > 0;
+	if (!ventanas && !cadena)
+		return monedasPDVector<T>(v, C, totalutilizados);
+
+	// Creamos el vector e inicializamos los casos base
+	vector<T> monedas(C + 1, infinito<T>());
+	monedas[0] = 0;
+
+	if (ventanas)
+		rellenarPorVentanas(v, monedas, C, hilos);
+	else
+		rellenarEnCadena(v, monedas, C, hilos);
+
+	return reconstruir(v, monedas, C, totalutilizados);
+}
+
+template pair<int, vector<int>> monedasPDVectorParalelo<uint8_t>(vector<int> const &v, int C, int &totalutilizados, int hilos);
+template pair<int, vector<int>> monedasPDVectorParalelo<uint16_t>(vector<int> const &v, int C, int &totalutilizados, int hilos);
+template pair<int, vector<int>> monedasPDVectorParalelo<uint32_t>(vector<int> const &v, int C, int &totalutilizados, int hilos);
 
-	// Creamos los ficheros
-	ofstream salida("SalidaPDVector.txt");
-	ofstream salidaGraficarX("GraficaXPDVector.txt");
-	ofstream salidaGraficarY("GraficaYPDVector.txt");
+pair<int, vector<int>> monedasPDVectorParalelo(vector<int> const &v, int C, int &totalutilizados, int hilos) {
+	return segunCelda(cotaMonedas(v, C), [&](auto celda) {
+		return monedasPDVectorParalelo<decltype(celda)>(v, C, totalutilizados, hilos);
+	});
+}
 
-	// Hacemos las pruebas en el intervalo de iteraciones decidido
-	for (int i = IT_MIN; i < IT_MAX + 1; i = i + SUMA)
-		prueba(i, salida, salidaGraficarX, salidaGraficarY);
+/*
+  Adaptador de monedasPDVector a la interfaz común
 
-	// Cerramos los ficheros
-	salida.close();
-	salidaGraficarX.close();
-	salidaGraficarY.close();
+  La función original devuelve cuantas[i] para el tipo v[i - 1], así que lo desplazamos una posición
+*/
+Resultado resolverPDVector(vector<int> const &M, int C) {
+	Resultado r;
+	int totalutilizados = 0;
+	auto sol = monedasPDVector(M, C, totalutilizados);
+	r.total = sol.first;
+	r.cuantas.assign(sol.second.begin() + 1, sol.second.end());
+	return r;
 }
 
-int main() {
-	fichero();
-	system("pause");
-	return 0;
-}
\ No newline at end of file
+/*
+  Versión de monedasPDVector sin reservas de memoria: el vector de la recursión es un bloque del espacio
+  de trabajo y la solución se escribe directamente en cuantas
+*/
+int resolverPDVectorSinReservas(vector<int> const &M, int C, Espacio &espacio, int *cuantas) {
+	return segunCelda(cotaMonedas(M, C), [&](auto celda) {
+		using T = decltype(celda);
+		T *monedas = espacio.pedir<T>(C + 1);
+		rellenar(M, monedas, C);
+		return reconstruir(M, (T const *)monedas, C, cuantas);
+	});
+}
+
+/*
+  Adaptador de monedasPDVectorParalelo a la interfaz común, con tantos hilos como núcleos
+
+  Si el trabajo es pequeño, crear los hilos cuesta más de lo que se gana, así que se usa uno solo
+*/
+Resultado resolverPDParalelo(vector<int> const &M, int C) {
+	Resultado r;
+	int totalutilizados = 0;
+	int hilos = (long long)M.size() * C < TRABAJO_MINIMO_PARALELO ? 1 : max(1u, thread::hardware_concurrency());
+	auto sol = monedasPDVectorParalelo(M, C, totalutilizados, hilos);
+	r.total = sol.first;
+	r.cuantas.assign(sol.second.begin() + 1, sol.second.end());
+	return r;
+}
@@ -1,58 +1,39 @@
 /*
 	Problema de las monedas
 
-	Implementacin con mtodo voraz
+	Implementación con método voraz
 
-	Mtodos algortmicos en Resolucin de Problemas
-	Facultad de Informtica
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
 	Universidad Complutense de Madrid
 
 	Beatriz Herguedas Pinedo
 */
 
 // Condicion suficiente pero no necesaria (puede ser que de la sol optima sin cumplir las hipotesis)
-#include <algorithm>
 #include <climits>
-#include <cmath>
-#include <ctime>
-#include <fstream>
-#include <iomanip>
-#include <iostream>
-#include <stdio.h>
-#include <stdlib.h> 
-#include <time.h>
-#include <unordered_map>
 #include <vector>
 
-using namespace std;
-
-// Constantes que indican el intervalo del nmero de iteraciones del bucle
-int const IT_MIN = 5000000;
-int const IT_MAX = 6500000;
-
-// De cunto en cunto se va iterando el bucle
-int const SUMA = 10000;
+#include "Monedas.h"
 
-// Constantes que indican el intervalo en el que queremos que se mueva el random
-int const RA_MIN = 1;
-int const RA_MAX = 2;
+using namespace std;
 
 /*
-  Funcin que resuelve el problema de las monedas con el mtodo voraz, 
-  teniendo en cuenta las hiptesis necesarias:
-  1. Los tipos de monedas estn ordenados en orden estrictamente creciente
+  Función que resuelve el problema de las monedas con el método voraz, 
+  teniendo en cuenta las hipótesis necesarias:
+  1. Los tipos de monedas están ordenados en orden estrictamente creciente
   2. Cantidad de monedas disponible de cada tipo ilimitada
   3. Los tipos de monedas son todas las potencias entre 0 y N de una cierta base estrictamente mayor que 1
-  4. El nmero de tipos de monedas sea finito
+  4. El número de tipos de monedas sea finito
 
-  Recibe como parmetros:
+  Recibe como parámetros:
   M, que es el vector que contiene los tipos de monedas
   C, que es la cantidad que queremos alcanzar
-  totalutilizadas, que es el nmero total de monedas que utilizamos
-  w, que es un vector de pares que almacena cuntas monedas de cada tipo utilizamos
+  totalutilizadas, que es el número total de monedas que utilizamos
+  w, que es un vector de pares que almacena cuántas monedas de cada tipo utilizamos
 
   El algoritmo consiste en recorrer desde el final el vector con los tipos de monedas ordenado crecientemente,
-  de forma que primero miramos los tipos de monedas ms grandes, y nos vamos quedando con todas las ms grandes
+  de forma que primero miramos los tipos de monedas más grandes, y nos vamos quedando con todas las más grandes
   que nos caben hasta llegar a alcanzar la cantidad C
 */
 vector<int> monedasVoraz1(vector<int> const &M, int C, int &totalutilizadas, vector<pair<int, int>> &w) {
@@ -65,13 +46,13 @@ vector<int> monedasVoraz1(vector<int> const &M, int C, int &totalutilizadas, vec
 
 	// Mientras no hayamos alcanzado la cantidad y no hayamos terminado de mirar todos los tipos de monedas
 	while (falta != 0 && i > -1) {
-		// En sol[i] guardamos el nmero de monedas que vamos a utilizar del tipo que se encuentra en M[i]
+		// En sol[i] guardamos el número de monedas que vamos a utilizar del tipo que se encuentra en M[i]
 		sol[i] = falta / M[i];
 
-		// Actualizamos el nmero total de monedas que llevamos hasta el momento
+		// Actualizamos el número total de monedas que llevamos hasta el momento
 		totalutilizadas += sol[i];
 
-		// Si hemos metido ms de 0 monedas de un tipo, lo inclumos en nuestro vector de cantidades y tipos
+		// Si hemos metido más de 0 monedas de un tipo, lo incluímos en nuestro vector de cantidades y tipos
 		if(sol[i] > 0)
 			w.push_back({ sol[i], M[i] });
 
@@ -86,140 +67,41 @@ vector<int> monedasVoraz1(vector<int> const &M, int C, int &totalutilizadas, vec
 	return sol;
 }
 
+
 /*
-  Funcin que realiza las pruebas
+  Adaptador de monedasVoraz1 a la interfaz común
 
-  Recibe como parmetros:
-  N, que es el nmero total de tipos de monedas que tenemos
-  salida, flujo de salida para escribir por fichero toda la informacin necesaria sobre la prueba
-  salidaGraficaX, flujo de salida para escribir por fichero la informacin sobre el tamao de la prueba
-  salidaGraficaY, flujo de salida para escribir por fichero la informacin sobre el tiempo que ha durado la prueba
+  Como el método voraz no siempre alcanza la cantidad C cuando no se cumplen las hipótesis,
+  comprobamos al final lo que hemos pagado y, si no es exactamente C, indicamos que no hay solución
 */
-void prueba(int N, ofstream &salida, ofstream &salidaGraficarX, ofstream &salidaGraficarY) {
-
-	// Generamos la semilla del random en funcin del tiempo
-	srand(time(NULL));
-
-	// Creamos la base (queremos que sea siempre 2 porque si no al hacer las potencias nos salimos de rango)
-	int base = 2;
-
-	// Creamos nuestra moneda, que inicializamos al valor de la base
-	int valorMoneda = base;
-	//int valorMoneda;
-
-	// Creamos el vector que va a almacenar los tipos de monedas e insertamos un 1 (pues la primera potencia es elevar a 0)
-	vector<int> tiposMonedas;
-	tiposMonedas.push_back(1);
-
-	// Para cuando queremos insertar la entrada cumpliendo las hiptesis
-	// Recorremos el vector insertando los tipos de monedas
-	/*for (int i = 1; i < N; i++) {
-		tiposMonedas.push_back(valorMoneda);
-
-		// La siguiente moneda a insertar ser la sigiente potencia, es decir, volver a multiplicar por la base
-		valorMoneda *= base;
-	}*/
-
-	// Para cuando queremos insertar la entrada sin cumplir las hiptesis
-	// Recorremos el vector insertando los tipos de monedas
-	for (int i = 0; i < N; ++i) {
-
-		// Le damos un valor aleatorio (entre 1 y 4 * N) a la moneda que vamos a insertar
-		valorMoneda = 1 + rand() % (4 * N);
-
-		// Cuando ya sabemos seguro que la moneda no est entre las que tenamos, la insertamos
-		// en el vector que almacena los tipos de moneda
-		tiposMonedas.push_back(valorMoneda);
-	}
-
-	// Creamos el vector en el que vamos a devolver cuntas monedas de cada tipo hemos utilizado
-	vector <pair<int, int>> w;
-
-	// Le damos un valor a C, que es la cantidad que queremos alcanzar para resolver el problema
-	// En este caso el valor elegido es 2^N
-	//int C = pow(2, N);
-	int C = 2 * N;
-
-	// Inicializamos el nmero total de monedas utilizadas a 0
+Resultado resolverVoraz1(vector<int> const &M, int C) {
+	Resultado r;
 	int totalutilizadas = 0;
+	vector<pair<int, int>> w;
+	r.cuantas = monedasVoraz1(M, C, totalutilizadas, w);
 
-	// Nos guardamos el tiempo justo antes de realizar la prueba
-	int t0 = clock();
-
-	// Realizamos la prueba llamando a la funcin que calcula la solucin
-	monedasVoraz1(tiposMonedas, C, totalutilizadas, w);
-
-	// Nos guardamos el tiempo justo al terminar la prueba
-	int t1 = clock();
+	// Sumamos lo que hemos pagado con las monedas elegidas
+	long long pagado = 0;
+	for (auto m : w)
+		pagado += (long long)m.first * m.second;
 
-	// Calculamos el tiempo que ha durado la prueba restando el inicial al final
-	double tiempo = double(t1 - t0) / CLOCKS_PER_SEC;
-
-	/////////////////////////////////////////////////////////////////////////////
-	// Ahora escribimos en los archivos
-
-	// Primero en salida
-	salida << "Nmero de tipos de monedas que tenemos: " << N << '\n';
-	salida << "Queremos alcanzar la cantidad " << C << '\n';
-	salida << "Cantidad total de monedas utilizadas: " << totalutilizadas << '\n';
-
-	salida << "Hemos cogido ";
-	for (auto m : w) {
-		if(m.first > 0)
-			salida << m.first << " monedas del tipo " << m.second << '\n';
-	}
-
-	salida << "Tiempo requerido = " << tiempo << " segundos" << '\n';
-	salida << "--------------------------\n";
-
-	// Despus en grficaX
-	salidaGraficarX << N << '\n';
-
-	// Y por ltimo en grficaY
-	salidaGraficarY << fixed;
-	salidaGraficarY << setprecision(3) << tiempo << '\n';
-
-	/////////////////////////////////////////////////////////////////////////////
-
-	// Sacamos por pantalla el nmero de tipos
-	cout << "N = " << N << '\n';
-
-	// Cuntas de cada tipo
-	/*for (auto m : w) {
-		if (m.first > 0)
-			cout << m.first << " " << m.second << '\n';
-	}*/
-
-	// Y el tiempo requerido
-	cout << "Tiempo requerido = " << setprecision(3) << tiempo << " segundos" << '\n';
+	r.total = pagado == C ? totalutilizadas : INT_MAX;
+	return r;
 }
 
 /*
-  Funcin que escribe en los ficheros
-
-  - El fichero "SalidaVoraz1" contiene la salida con toda la informacin
-  - El fichero "GraficaXVoraz1" contiene tan solo informacin de los tamaos de cara a pintar la grfica
-  - El fichero "GraficaYVoraz1" contiene tan solo informacin de los tiempos de cara a pintar la grfica
+  Versión de monedasVoraz1 sin reservas de memoria: hace el mismo recorrido escribiendo directamente
+  en cuantas, sin el vector de soluciones ni el de pares
 */
-void fichero() {
-
-	// Creamos los ficheros
-	ofstream salida("SalidaVoraz1.txt");
-	ofstream salidaGraficarX("GraficaXVoraz1.txt");
-	ofstream salidaGraficarY("GraficaYVoraz1.txt");
-
-	// Hacemos las pruebas en el intervalo de iteraciones decidido
-	for (int i = IT_MIN; i < IT_MAX + 1; i = i + SUMA)
-		prueba(i, salida, salidaGraficarX, salidaGraficarY);
-
-	// Cerramos los ficheros
-	salida.close();
-	salidaGraficarX.close();
-	salidaGraficarY.close();
+int resolverVoraz1SinReservas(vector<int> const &M, int C, Espacio &, int *cuantas) {
+	int falta = C;
+	int total = 0;
+	for (int i = M.size() - 1; i > -1; i--) {
+		int n = falta / M[i];
+		if (cuantas != nullptr)
+			cuantas[i] = n;
+		total += n;
+		falta = falta % M[i];
+	}
+	return falta == 0 ? total : INT_MAX;
 }
-
-int main() {
-	fichero();
-	system("pause");
-	return 0;
-}
\ No newline at end of file
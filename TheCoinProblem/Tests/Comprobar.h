@@ -0,0 +1,101 @@
+/*
+	Problema de las monedas
+
+	Utilidades comunes de las pruebas automáticas
+
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
+	Universidad Complutense de Madrid
+
+	Beatriz Herguedas Pinedo
+*/
+
+#ifndef COMPROBAR_H
+#define COMPROBAR_H
+
+#include <climits>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <set>
+#include <vector>
+
+// Número de comprobaciones que han fallado
+inline int &fallos() {
+	static int n = 0;
+	return n;
+}
+
+// Comprueba la condición y, si no se cumple, cuenta el fallo y escribe dónde ha sido
+#define COMPROBAR(condicion)                                                                              \
+	do {                                                                                                  \
+		if (!(condicion)) {                                                                               \
+			++fallos();                                                                                   \
+			std::cerr << __FILE__ << ':' << __LINE__ << ": falla " #condicion << '\n';                  \
+		}                                                                                                 \
+	} while (0)
+
+// Comprueba que la expresión lanza la excepción del tipo indicado
+#define COMPROBAR_LANZA(expresion, excepcion)                                                             \
+	do {                                                                                                  \
+		bool lanza = false;                                                                               \
+		try {                                                                                             \
+			expresion;                                                                                    \
+		}                                                                                                 \
+		catch (excepcion const &) {                                                                       \
+			lanza = true;                                                                                 \
+		}                                                                                                 \
+		COMPROBAR(lanza);                                                                                 \
+	} while (0)
+
+// Termina la prueba: escribe el resultado y devuelve el código de salida del programa
+inline int terminar(char const *nombre) {
+	if (fallos() == 0)
+		std::cout << nombre << ": correcto\n";
+	else
+		std::cout << nombre << ": " << fallos() << " fallos\n";
+	return fallos() == 0 ? 0 : 1;
+}
+
+// Sistema monetario aleatorio de N monedas distintas entre 1 y maximo, ordenado crecientemente
+inline std::vector<int> sistemaAleatorio(std::mt19937 &g, int N, int maximo, bool unidad) {
+	std::set<int> s;
+	if (unidad)
+		s.insert(1);
+	while ((int)s.size() < N)
+		s.insert(1 + (int)(g() % maximo));
+	return std::vector<int>(s.begin(), s.end());
+}
+
+/*
+  Programación dinámica directa, sin ninguna optimización, con la que comparamos los demás algoritmos
+
+  Devuelve en minimo[x] el número mínimo de monedas para la cantidad x (INT_MAX si no se puede alcanzar)
+*/
+inline std::vector<int> minimosReferencia(std::vector<int> const &M, int C) {
+	std::vector<int> minimo(C + 1, INT_MAX);
+	minimo[0] = 0;
+	for (int x = 1; x <= C; ++x) {
+		for (int m : M) {
+			if (m <= x && minimo[x - m] != INT_MAX)
+				minimo[x] = std::min(minimo[x], minimo[x - m] + 1);
+		}
+	}
+	return minimo;
+}
+
+// Comprueba que cuantas es un desglose válido de C con total monedas
+inline bool desgloseValido(std::vector<int> const &M, std::vector<int> const &cuantas, long long C, long long total) {
+	if (cuantas.size() != M.size())
+		return false;
+	long long suma = 0, monedas = 0;
+	for (size_t i = 0; i < M.size(); ++i) {
+		if (cuantas[i] < 0)
+			return false;
+		suma += (long long)cuantas[i] * M[i];
+		monedas += cuantas[i];
+	}
+	return suma == C && monedas == total;
+}
+
+#endif
@@ -0,0 +1,75 @@
+/*
+	Problema de las monedas
+
+	Pruebas de la búsqueda en anchura por bits (monedasBFS.cpp)
+
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
+	Universidad Complutense de Madrid
+
+	Beatriz Herguedas Pinedo
+*/
+
+#include <climits>
+#include <random>
+#include <vector>
+
+#include "Comprobar.h"
+#include "Monedas.h"
+
+using namespace std;
+
+// Comprueba monedasBFS y la versión sin reservas (con un espacio reutilizado) contra el mínimo de referencia
+static void comprobarCantidad(vector<int> const &M, int C, int esperado, Espacio &espacio) {
+	int total = 0;
+	pair<int, vector<int>> r = monedasBFS(M, C, total);
+	COMPROBAR(r.first == esperado);
+	if (esperado == INT_MAX)
+		COMPROBAR(total == 0 && r.second == vector<int>(M.size(), 0));
+	else
+		COMPROBAR(total == esperado && desgloseValido(M, r.second, C, esperado));
+
+	vector<int> cuantas(M.size(), -1);
+	COMPROBAR(resolverBFSSinReservas(M, C, espacio, cuantas.data()) == esperado);
+	COMPROBAR(cuantas == r.second);
+}
+
+int main() {
+	mt19937 g(20240609);
+	Espacio espacio;
+
+	// Sistemas sin la moneda unidad, con cantidades que no se pueden alcanzar: unas porque no son múltiplo
+	// del máximo común divisor y otras porque un nivel deja de añadir cantidades
+	for (int prueba = 0; prueba < 400; ++prueba) {
+		vector<int> M = sistemaAleatorio(g, 1 + prueba % 5, 40, prueba % 4 == 0);
+		if (prueba % 3 == 0) {
+			for (int &m : M)
+				m *= 2 + prueba % 3;
+		}
+		vector<int> minimo = minimosReferencia(M, 2500);
+		for (int C = 0; C <= 2500; C += 1 + (int)(g() % 41))
+			comprobarCantidad(M, C, minimo[C], espacio);
+	}
+
+	// Casos conocidos: el máximo común divisor, cantidades inalcanzables con mcd 1 y un sistema no canónico
+	comprobarCantidad({ 4, 6 }, 9, INT_MAX, espacio);
+	comprobarCantidad({ 4, 6 }, 10, 2, espacio);
+	comprobarCantidad({ 3, 5 }, 7, INT_MAX, espacio);
+	comprobarCantidad({ 3, 5 }, 8, 2, espacio);
+	comprobarCantidad({ 1, 3, 4 }, 6, 2, espacio);
+	comprobarCantidad({}, 0, 0, espacio);
+	comprobarCantidad({}, 3, INT_MAX, espacio);
+	comprobarCantidad({ 64, 128 }, 64 * 63, 32, espacio);
+
+	// Soluciones de más de MAX_NIVELES = 64 monedas, que pasan a la programación dinámica con vector,
+	// y cantidades justo alrededor de ese límite y de los bordes de las palabras de 64 bits
+	for (vector<int> M : { vector<int>{ 1 }, vector<int>{ 7, 11 }, vector<int>{ 2, 63, 65 }, vector<int>{ 5, 64, 100 } }) {
+		vector<int> minimo = minimosReferencia(M, 20000);
+		for (int C = 0; C <= 20000; C += 1 + C / 50)
+			comprobarCantidad(M, C, minimo[C], espacio);
+		for (int C : { 63, 64, 65, 127, 128, 129, 4095, 4096, 4097, 19999, 20000 })
+			comprobarCantidad(M, C, minimo[C], espacio);
+	}
+
+	return terminar("BFS");
+}
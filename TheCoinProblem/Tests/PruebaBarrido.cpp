@@ -0,0 +1,130 @@
+/*
+	Problema de las monedas
+
+	Pruebas del reparto de las pruebas entre hilos (Barrido.cpp)
+
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
+	Universidad Complutense de Madrid
+
+	Beatriz Herguedas Pinedo
+*/
+
+#include <chrono>
+#include <climits>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+#include "Barrido.h"
+#include "Comprobar.h"
+
+using namespace std;
+
+// Algoritmos ficticios del barrido, que dan nombre a los ficheros de texto
+vector<string> const NOMBRES = { "BarridoA", "BarridoB", "BarridoC" };
+
+int const NUM_TAREAS = 90;
+
+// Ficheros que escribe el sumidero con los formatos texto y csv
+static vector<string> ficheros() {
+	vector<string> f = { "Resultados.csv" };
+	for (string const &n : NOMBRES) {
+		for (string const &prefijo : { "Salida", "GraficaX", "GraficaY", "Estadisticas" })
+			f.push_back(prefijo + n + ".txt");
+	}
+	return f;
+}
+
+static string leer(string const &fichero) {
+	ifstream entrada(fichero);
+	stringstream contenido;
+	contenido << entrada.rdbuf();
+	return contenido.str();
+}
+
+/*
+  Hace un barrido con las opciones o de pruebas que tardan distinto (para que terminen desordenadas), algunas
+  fallidas y algunas de algoritmos multihilo, y devuelve el contenido de los ficheros del sumidero
+*/
+static vector<string> barrer(OpcionesBarrido const &o) {
+	// El sumidero escribe por pantalla el resumen de cada prueba, que aquí no interesa
+	streambuf *pantalla = cout.rdbuf(nullptr);
+	{
+		Barrido barrido(o);
+		Sumidero sumidero(NOMBRES, TEXTO | CSV, 20240627, "prueba", false);
+		auto tarea = [](int j, OpcionesMedicion const &, Contadores *, Registro &r) {
+			this_thread::sleep_for(chrono::microseconds(j * 7919 % 13 * 100));
+			if (j % 11 == 5)
+				return false;
+			r.algoritmo = j % 3;
+			r.N = j / 3;
+			r.C = 2 * r.N;
+			r.total = j % 7 == 0 ? INT_MAX : j;
+			r.usadas = { { j % 4 + 1, 1 } };
+			r.nodos = j;
+			r.estadisticas.minimo = r.estadisticas.mediana = r.estadisticas.media = r.estadisticas.p99 = j * 1e-6;
+			r.estadisticas.repeticiones = 1;
+			return true;
+		};
+		auto multihilo = [](int j) { return j % 3 == 2; };
+		barrido.ejecutar(NUM_TAREAS, OpcionesMedicion(), false, tarea, multihilo, sumidero);
+	}
+	cout.rdbuf(pantalla);
+	cout.clear();
+
+	vector<string> contenido;
+	for (string const &f : ficheros())
+		contenido.push_back(leer(f));
+	return contenido;
+}
+
+#ifdef __linux__
+// Procesadores en los que puede ejecutarse el hilo actual
+static vector<int> afinidad() {
+	cpu_set_t conjunto;
+	CPU_ZERO(&conjunto);
+	sched_getaffinity(0, sizeof(conjunto), &conjunto);
+	vector<int> p;
+	for (int c = 0; c < CPU_SETSIZE; ++c) {
+		if (CPU_ISSET(c, &conjunto))
+			p.push_back(c);
+	}
+	return p;
+}
+#endif
+
+int main() {
+#ifdef __linux__
+	vector<int> antes = afinidad();
+#endif
+
+	// Los ficheros salen iguales con cualquier número de hilos, aislados o no, que con uno solo
+	vector<string> uno = barrer(OpcionesBarrido());
+	COMPROBAR(uno[0].size() > 0 && uno[1].size() > 0);
+	for (int hilos : { 2, 3, 8 }) {
+		for (bool aislado : { false, true }) {
+			OpcionesBarrido o;
+			o.hilos = hilos;
+			o.aislado = aislado;
+			COMPROBAR(barrer(o) == uno);
+		}
+	}
+
+#ifdef __linux__
+	// En el modo aislado el constructor fija el hilo actual a un núcleo, y el destructor lo deshace
+	COMPROBAR(afinidad() == antes);
+#endif
+
+	for (string const &f : ficheros())
+		remove(f.c_str());
+	return terminar("Barrido");
+}
@@ -0,0 +1,96 @@
+/*
+	Problema de las monedas
+
+	Pruebas del método de Pearson y de la comprobación sin moneda unidad (Canonico.h)
+
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
+	Universidad Complutense de Madrid
+
+	Beatriz Herguedas Pinedo
+*/
+
+#include <climits>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "Canonico.h"
+#include "Comprobar.h"
+#include "Monedas.h"
+
+using namespace std;
+
+// Menor cantidad hasta C para la que el método voraz no da el mínimo (0 si no hay ninguna)
+static long long contraejemploReferencia(vector<int> const &M, int C) {
+	vector<int> minimo = minimosReferencia(M, C);
+	for (int x = 1; x <= C; ++x) {
+		if (minimo[x] == INT_MAX)
+			continue;
+		int totalutilizadas = 0;
+		vector<pair<int, int>> w;
+		monedasVoraz1(M, x, totalutilizadas, w);
+		if (totalutilizadas != minimo[x])
+			return x;
+	}
+	return 0;
+}
+
+int main() {
+	mt19937 g(20240611);
+
+	// Sistemas conocidos
+	COMPROBAR(contraejemploMinimo({ 1, 2, 5, 10, 20, 50, 100, 200 }) == 0);
+	COMPROBAR(contraejemploMinimo({ 1, 3, 4 }) == 6);
+	COMPROBAR(contraejemploMinimo({ 1, 5, 10, 12 }) == 15);
+	COMPROBAR(contraejemploMinimo({ 1 }) == 0);
+	COMPROBAR(contraejemploMinimo({}) == 0);
+
+	// Con la moneda unidad, el método de Pearson contra la programación dinámica hasta la cota de Kozen y Zaks
+	for (int prueba = 0; prueba < 2000; ++prueba) {
+		vector<int> M = sistemaAleatorio(g, 2 + prueba % 6, 60, true);
+		int N = M.size();
+		long long esperado = contraejemploReferencia(M, M[N - 1] + M[N - 2]);
+		COMPROBAR(contraejemploMinimo(M) == esperado);
+	}
+
+	// Sin la moneda unidad, la comparación hasta la suma de las dos monedas mayores
+	for (int prueba = 0; prueba < 1000; ++prueba) {
+		vector<int> M = sistemaAleatorio(g, 2 + prueba % 5, 60, false);
+		if (M[0] == 1)
+			continue;
+		int N = M.size();
+		COMPROBAR(contraejemploMinimo(M) == contraejemploReferencia(M, M[N - 1] + M[N - 2]));
+	}
+
+	// Monedas demasiado grandes para comprobarlo: no se sabe, y se trata como no canónico
+	COMPROBAR(contraejemploMinimo({ 2, 1000000000 }) == -1);
+	COMPROBAR(!esCanonico({ 2, 1000000000 }));
+
+	// SistemaMonetario resuelve igual que la programación dinámica
+	for (int prueba = 0; prueba < 300; ++prueba) {
+		vector<int> M = sistemaAleatorio(g, 2 + prueba % 6, 40, prueba % 2 == 0);
+		SistemaMonetario s(M);
+		vector<int> minimo = minimosReferencia(M, 200);
+		for (int C = 0; C <= 200; C += 7) {
+			Resultado r = s.resolver(C);
+			COMPROBAR(r.total == minimo[C]);
+			if (r.total != INT_MAX)
+				COMPROBAR(desgloseValido(M, r.cuantas, C, r.total));
+		}
+	}
+
+	// resolverLote da los mismos totales que resolver, con el método voraz por lotes o sin él
+	for (int prueba = 0; prueba < 300; ++prueba) {
+		vector<int> M = sistemaAleatorio(g, 2 + prueba % 6, 40, prueba % 3 != 0);
+		SistemaMonetario s(M);
+		vector<int32_t> cantidades(prueba % 40), totales(cantidades.size());
+		for (int32_t &C : cantidades)
+			C = g() % 300;
+		s.resolverLote(cantidades.data(), cantidades.size(), totales.data());
+		for (size_t j = 0; j < cantidades.size(); ++j)
+			COMPROBAR(totales[j] == s.resolver(cantidades[j]).total);
+	}
+
+	return terminar("Canonico");
+}
@@ -0,0 +1,126 @@
+/*
+	Problema de las monedas
+
+	Pruebas de las cantidades de 64 bits (CantidadesGrandes.h)
+
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
+	Universidad Complutense de Madrid
+
+	Beatriz Herguedas Pinedo
+*/
+
+#include <climits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "CantidadesGrandes.h"
+#include "Comprobar.h"
+#include "Monedas.h"
+
+using namespace std;
+
+// Comprueba el mínimo y el desglose de C contra el mínimo esperado (-1 si no se puede alcanzar)
+static void comprobarCantidad(CantidadesGrandes const &g, vector<int> const &M, long long C, long long esperado) {
+	COMPROBAR(g.minimo(C) == esperado);
+	vector<long long> cuantas;
+	bool hay = g.desglose(C, cuantas);
+	COMPROBAR(hay == (esperado >= 0));
+	if (hay) {
+		long long suma = 0, monedas = 0;
+		for (size_t i = 0; i < M.size(); ++i) {
+			COMPROBAR(cuantas[i] >= 0);
+			suma += cuantas[i] * M[i];
+			monedas += cuantas[i];
+		}
+		COMPROBAR(suma == C);
+		COMPROBAR(monedas == esperado);
+	}
+	else
+		COMPROBAR(cuantas.empty());
+}
+
+int main() {
+	mt19937 g(20240612);
+
+	// Dijkstra sobre los restos contra la programación dinámica, con y sin la moneda unidad, por debajo
+	// y por encima del umbral (y justo alrededor de él)
+	for (int prueba = 0; prueba < 1500; ++prueba) {
+		vector<int> M = sistemaAleatorio(g, 1 + prueba % 6, 50, prueba % 3 == 0);
+		CantidadesGrandes grandes(M);
+		int N = M.size();
+		long long umbral = grandes.umbral();
+		COMPROBAR(umbral <= (long long)M[N - 1] * (N > 1 ? M[N - 2] : 1));
+
+		int hasta = (int)umbral + 3 * M[N - 1] + 10;
+		vector<int> minimo = minimosReferencia(M, hasta);
+		for (int C = 0; C <= hasta; ++C)
+			comprobarCantidad(grandes, M, C, minimo[C] == INT_MAX ? -1 : minimo[C]);
+		COMPROBAR(grandes.minimo(-1) == -1);
+	}
+
+	// Cantidades de 64 bits: por encima del umbral, sumar la moneda mayor suma exactamente una moneda
+	for (int prueba = 0; prueba < 300; ++prueba) {
+		vector<int> M = sistemaAleatorio(g, 2 + prueba % 5, 1000, prueba % 2 == 0);
+		CantidadesGrandes grandes(M);
+		long long m = M.back();
+		long long C = (long long)(g() % (1u << 30)) * (1 << 20) + g() % 1000;
+		long long esperado = grandes.minimo(C);
+		long long siguiente = grandes.minimo(C + m);
+		COMPROBAR(siguiente == (esperado < 0 ? -1 : esperado + 1));
+
+		// Y el resultado coincide con el de una cantidad pequeña con el mismo resto
+		long long pequena = grandes.umbral() + 1 + ((C - grandes.umbral() - 1) % m);
+		long long base = grandes.minimo(pequena);
+		COMPROBAR(esperado == (base < 0 ? -1 : base + (C - pequena) / m));
+		comprobarCantidad(grandes, M, C, esperado);
+	}
+
+	// Un sistema con una moneda gigante no se puede preprocesar, pero el adaptador no falla
+	vector<int> enorme = { 2, 1000000000 };
+	bool lanza = false;
+	try {
+		CantidadesGrandes grandes(enorme);
+	}
+	catch (length_error const &) {
+		lanza = true;
+	}
+	COMPROBAR(lanza);
+	COMPROBAR_LANZA(CantidadesGrandes({ 1, 3, 100000 }, 1e6), length_error);
+	COMPROBAR_LANZA(CantidadesGrandes({ 2, 999, 1000 }, 30000), length_error);
+	COMPROBAR(CantidadesGrandes({ 2, 999, 1000 }, 1e7).minimo(1000000001) == 1000001);
+	COMPROBAR(resolverGrandes(enorme, 32).total == 16);
+	COMPROBAR(resolverGrandes(enorme, 33).total == INT_MAX);
+
+	// Para cantidades pequeñas el adaptador usa la programación dinámica y da lo mismo
+	for (int prueba = 0; prueba < 200; ++prueba) {
+		vector<int> M = sistemaAleatorio(g, 1 + prueba % 6, 30, prueba % 2 == 0);
+		vector<int> minimo = minimosReferencia(M, 3000);
+		for (int C = 0; C <= 3000; C += 37) {
+			Resultado r = resolverGrandes(M, C);
+			COMPROBAR(r.total == minimo[C]);
+			if (r.total != INT_MAX)
+				COMPROBAR(desgloseValido(M, r.cuantas, C, r.total));
+		}
+	}
+
+	// El adaptador de 64 bits: igual que el de 32 hasta INT_MAX, y por encima igual que la clase
+	for (int prueba = 0; prueba < 100; ++prueba) {
+		vector<int> M = sistemaAleatorio(g, 2 + prueba % 5, 1000, prueba % 2 == 0);
+		int C = g() % 100000;
+		Resultado pequena = resolverGrandes64(M, C);
+		Resultado normal = resolverGrandes(M, C);
+		COMPROBAR(pequena.total == normal.total && pequena.cuantas == normal.cuantas);
+
+		long long grande = (long long)INT_MAX + 1 + (long long)(g() % (1u << 30)) * 64;
+		Resultado r = resolverGrandes64(M, grande);
+		long long esperado = CantidadesGrandes(M).minimo(grande);
+		COMPROBAR(r.total == (esperado < 0 ? INT_MAX : esperado));
+		if (esperado >= 0)
+			COMPROBAR(desgloseValido(M, r.cuantas, grande, esperado));
+	}
+	COMPROBAR_LANZA(resolverGrandes64({ 1, 2 }, 1LL << 40), overflow_error);
+
+	return terminar("CantidadesGrandes");
+}
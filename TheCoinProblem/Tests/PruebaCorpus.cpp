@@ -0,0 +1,89 @@
+/*
+	Problema de las monedas
+
+	Pruebas del corpus binario de instancias (Corpus.h)
+
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
+	Universidad Complutense de Madrid
+
+	Beatriz Herguedas Pinedo
+*/
+
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "Comprobar.h"
+#include "Corpus.h"
+
+using namespace std;
+
+// Fichero temporal en el que escribimos los corpus de las pruebas
+string const FICHERO = "PruebaCorpus.bin";
+
+// Escribe el corpus modificado por cambiar y dice si se puede abrir
+static bool seAbre(string const &original, function<void(string &)> const &cambiar) {
+	string datos = original;
+	cambiar(datos);
+	{
+		ofstream salida(FICHERO, ios::binary);
+		salida << datos;
+	}
+	try {
+		Corpus corpus(FICHERO);
+		return true;
+	}
+	catch (runtime_error const &) {
+		return false;
+	}
+}
+
+// Entrada i del índice dentro de los datos del fichero
+static IndiceCorpus &indice(string &datos, int i) {
+	return *(IndiceCorpus *)&datos[sizeof(CabeceraCorpus) + i * sizeof(IndiceCorpus)];
+}
+
+int main() {
+	Generador generador(20240620);
+	Corpus::escribir(FICHERO, generador, { POTENCIAS, ALEATORIO }, { 5, 10, 20 });
+
+	// El corpus tiene las mismas instancias que el generador
+	{
+		Corpus corpus(FICHERO);
+		COMPROBAR(corpus.semilla() == 20240620);
+		COMPROBAR(corpus.size() == 6);
+		Instancia instancia;
+		COMPROBAR(corpus.buscar(ALEATORIO, 10, instancia));
+		COMPROBAR(instancia.tipos() == generador.monedas(ALEATORIO, 10));
+		COMPROBAR(instancia.C == 20);
+		COMPROBAR(!corpus.buscar(MULTIPLOS, 10, instancia));
+	}
+
+	string original;
+	{
+		ifstream entrada(FICHERO, ios::binary);
+		original.assign(istreambuf_iterator<char>(entrada), istreambuf_iterator<char>());
+	}
+
+	// Ficheros corruptos: se rechazan al abrirlos en vez de llegar a los algoritmos
+	COMPROBAR(seAbre(original, [](string &) {}));
+	COMPROBAR(!seAbre(original, [](string &d) { d[0] = 'X'; }));
+	COMPROBAR(!seAbre(original, [](string &d) { d.resize(d.size() - 1); }));
+	COMPROBAR(!seAbre(original, [](string &d) { *(int32_t *)&d[indice(d, 1).posicion] = 0; }));
+	COMPROBAR(!seAbre(original, [](string &d) {
+		int32_t *monedas = (int32_t *)&d[indice(d, 1).posicion];
+		swap(monedas[0], monedas[1]);
+	}));
+	COMPROBAR(!seAbre(original, [](string &d) { indice(d, 1).posicion += 1; }));
+	COMPROBAR(!seAbre(original, [](string &d) { indice(d, 1).posicion = ~0ULL - 3; }));
+	COMPROBAR(!seAbre(original, [](string &d) { swap(indice(d, 0), indice(d, 1)); }));
+	COMPROBAR(!seAbre(original, [](string &d) { indice(d, 2).familia = NUM_FAMILIAS; }));
+
+	remove(FICHERO.c_str());
+	return terminar("Corpus");
+}
@@ -0,0 +1,81 @@
+/*
+	Problema de las monedas
+
+	Pruebas del generador de sistemas monetarios (Generador.cpp)
+
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
+	Universidad Complutense de Madrid
+
+	Beatriz Herguedas Pinedo
+*/
+
+#include <algorithm>
+#include <climits>
+#include <vector>
+
+#include "Comprobar.h"
+#include "Generador.h"
+
+using namespace std;
+
+// Comprueba que M está ordenado crecientemente, sin repetidos y con todas las monedas entre minimo y maximo
+static bool enRango(vector<int> const &M, int minimo, int maximo) {
+	for (size_t i = 0; i < M.size(); ++i) {
+		if (M[i] < minimo || M[i] > maximo || (i > 0 && M[i - 1] >= M[i]))
+			return false;
+	}
+	return true;
+}
+
+int main() {
+	Generador generador(20240625), otro(20240626);
+
+	for (int N = 1; N <= 200; ++N) {
+		vector<int> aleatorio = generador.monedas(ALEATORIO, N);
+		COMPROBAR((int)aleatorio.size() == N && aleatorio[0] == 1 && enRango(aleatorio, 1, 4 * N));
+
+		// La familia sin unidad no tiene la moneda 1
+		vector<int> sinUnidad = generador.monedas(SINUNIDAD, N);
+		COMPROBAR((int)sinUnidad.size() == N && enRango(sinUnidad, 2, 4 * N + 1));
+
+		vector<int> potencias = generador.monedas(POTENCIAS, N);
+		COMPROBAR(potencias[0] == 1 && enRango(potencias, 1, INT_MAX));
+		for (size_t i = 1; i < potencias.size(); ++i)
+			COMPROBAR(potencias[i] == 2 * potencias[i - 1]);
+
+		vector<int> multiplos = generador.monedas(MULTIPLOS, N);
+		COMPROBAR(multiplos[0] == 1 && enRango(multiplos, 1, INT_MAX));
+		for (size_t i = 1; i < multiplos.size(); ++i) {
+			int factor = multiplos[i] / multiplos[i - 1];
+			COMPROBAR(multiplos[i] % multiplos[i - 1] == 0 && factor >= 2 && factor <= 4);
+		}
+
+		// Cada sistema depende solo de la semilla, la familia y N
+		COMPROBAR(generador.monedas(SINUNIDAD, N) == sinUnidad);
+		COMPROBAR(Generador(20240625).monedas(ALEATORIO, N) == aleatorio);
+	}
+
+	// Con otra semilla salen otros sistemas
+	COMPROBAR(otro.monedas(SINUNIDAD, 50) != generador.monedas(SINUNIDAD, 50));
+	COMPROBAR(otro.monedas(ALEATORIO, 50) != generador.monedas(ALEATORIO, 50));
+
+	// La versión paralela da los mismos sistemas que uno a uno
+	vector<int> numTipos = { 3, 1, 40, 7, 100, 2 };
+	for (int f = 0; f < NUM_FAMILIAS; ++f) {
+		vector<vector<int>> sistemas = generador.monedas(Familia(f), numTipos, 4);
+		for (size_t i = 0; i < numTipos.size(); ++i)
+			COMPROBAR(sistemas[i] == generador.monedas(Familia(f), numTipos[i]));
+	}
+
+	// Nombres de las familias
+	for (int f = 0; f < NUM_FAMILIAS; ++f) {
+		Familia encontrada;
+		COMPROBAR(buscarFamilia(nombreFamilia(Familia(f)), encontrada) && encontrada == f);
+	}
+	Familia encontrada;
+	COMPROBAR(buscarFamilia("sinunidad", encontrada) && encontrada == SINUNIDAD);
+	COMPROBAR(!buscarFamilia("unidad", encontrada));
+
+	return terminar("Generador");
+}
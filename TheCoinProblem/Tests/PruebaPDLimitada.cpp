@@ -0,0 +1,111 @@
+/*
+	Problema de las monedas
+
+	Pruebas de la programación dinámica con existencias limitadas (monedasPDLimitada.cpp)
+
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
+	Universidad Complutense de Madrid
+
+	Beatriz Herguedas Pinedo
+*/
+
+#include <algorithm>
+#include <climits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "Comprobar.h"
+#include "Monedas.h"
+#include "Planificador.h"
+
+using namespace std;
+
+// Mínimo de monedas para C con limites[i] monedas de M[i], aplicando cada moneda una vez por unidad disponible
+static int minimoLimitadoReferencia(vector<int> const &M, vector<int> const &limites, int C) {
+	vector<int> minimo(C + 1, INT_MAX);
+	minimo[0] = 0;
+	for (size_t i = 0; i < M.size(); ++i)
+		for (int k = 0; k < limites[i]; ++k)
+			for (int j = C; j >= M[i]; --j)
+				if (minimo[j - M[i]] != INT_MAX)
+					minimo[j] = min(minimo[j], minimo[j - M[i]] + 1);
+	return minimo[C];
+}
+
+// Comprueba las dos versiones contra la referencia y que el desglose respeta los límites
+static void comprobarLimitada(vector<int> const &M, vector<int> const &limites, int C) {
+	int esperado = minimoLimitadoReferencia(M, limites, C);
+	int total = 0;
+	pair<int, vector<int>> r = monedasPDLimitada(M, limites, C, total);
+	COMPROBAR(r.first == esperado);
+	COMPROBAR(monedasPDLimitadaTotal(M, limites, C) == esperado);
+	COMPROBAR(r.second.size() == M.size() + 1);
+	if (esperado == INT_MAX) {
+		COMPROBAR(total == 0);
+		COMPROBAR(count(r.second.begin(), r.second.end(), 0) == (long)r.second.size());
+		return;
+	}
+	COMPROBAR(total == esperado);
+	vector<int> cuantas(r.second.begin() + 1, r.second.end());
+	COMPROBAR(desgloseValido(M, cuantas, C, esperado));
+	for (size_t i = 0; i < M.size(); ++i)
+		COMPROBAR(cuantas[i] <= limites[i]);
+}
+
+int main() {
+	mt19937 g(20240618);
+
+	// Sistemas aleatorios con límites pequeños (que se alcanzan), algún límite a cero y cantidades inalcanzables
+	for (int prueba = 0; prueba < 2000; ++prueba) {
+		vector<int> M = sistemaAleatorio(g, 1 + prueba % 6, 40, prueba % 2 == 0);
+		vector<int> limites(M.size());
+		for (int &l : limites)
+			l = g() % 5;
+		int C = g() % 300;
+		comprobarLimitada(M, limites, C);
+	}
+
+	// Casos conocidos: el límite obliga a usar monedas peores, un límite a cero y un caso sin solución
+	vector<int> M = { 1, 5, 10, 25 };
+	comprobarLimitada(M, { 10, 10, 10, 1 }, 60);
+	int total = 0;
+	COMPROBAR(monedasPDLimitada(M, { 10, 10, 10, 1 }, 60, total).first == 5);
+	COMPROBAR(monedasPDLimitadaTotal(M, { 10, 0, 10, 2 }, 55) == 4);
+	COMPROBAR(monedasPDLimitadaTotal(M, { 4, 1, 1, 1 }, 45) == INT_MAX);
+	COMPROBAR(monedasPDLimitadaTotal(M, { 0, 0, 0, 0 }, 0) == 0);
+
+	// Tiene que haber un límite para cada tipo de moneda
+	bool lanza = false;
+	try {
+		monedasPDLimitada(M, { 1, 2 }, 10, total);
+	}
+	catch (invalid_argument const &) {
+		lanza = true;
+	}
+	COMPROBAR(lanza);
+	lanza = false;
+	try {
+		monedasPDLimitadaTotal(M, { 1, 2, 3, 4, 5 }, 10);
+	}
+	catch (invalid_argument const &) {
+		lanza = true;
+	}
+	COMPROBAR(lanza);
+
+	// El planificador renuncia al desglose si su tabla no cabe, y a todo si tampoco cabe el vector
+	Planificador planificador;
+	planificador.memoriaMaxima = 1e7;
+	vector<int> grande = { 1, 3, 7, 12, 30, 45, 60, 99 };
+	Plan p = planificador.planificarLimitada(grande, 100000);
+	COMPROBAR(p.algoritmo != nullptr && !p.soloTotal);
+	p = planificador.planificarLimitada(grande, 400000);
+	COMPROBAR(p.algoritmo != nullptr && p.soloTotal);
+	p = planificador.planificarLimitada(grande, 400000, false);
+	COMPROBAR(p.algoritmo != nullptr && p.soloTotal);
+	p = planificador.planificarLimitada(grande, 3000000);
+	COMPROBAR(p.algoritmo == nullptr);
+
+	return terminar("PDLimitada");
+}
@@ -0,0 +1,124 @@
+/*
+	Problema de las monedas
+
+	Pruebas de la programación dinámica con vector (monedasPDVector.cpp)
+
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
+	Universidad Complutense de Madrid
+
+	Beatriz Herguedas Pinedo
+*/
+
+#include <climits>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "Celdas.h"
+#include "Comprobar.h"
+#include "Monedas.h"
+
+using namespace std;
+
+// Comprueba monedasPDVector con celdas de tipo T para C contra el mínimo de referencia
+template <typename T>
+static void comprobarCelda(vector<int> const &M, int C, int esperado) {
+	if (cotaMonedas(M, C) >= infinito<T>())
+		return;
+	int total = 0;
+	pair<int, vector<int>> r = monedasPDVector<T>(M, C, total);
+	COMPROBAR(r.first == esperado);
+	COMPROBAR(r.second.size() == M.size() + 1);
+	vector<int> cuantas(r.second.begin() + 1, r.second.end());
+	if (esperado == INT_MAX)
+		COMPROBAR(total == 0 && cuantas == vector<int>(M.size(), 0));
+	else
+		COMPROBAR(total == esperado && desgloseValido(M, cuantas, C, esperado));
+}
+
+// Comprueba que la versión paralela con celdas de tipo T da exactamente el mismo resultado que la secuencial
+template <typename T>
+static void comprobarParalelo(vector<int> const &M, int C) {
+	if (cotaMonedas(M, C) >= infinito<T>())
+		return;
+	int total = 0;
+	pair<int, vector<int>> secuencial = monedasPDVector<T>(M, C, total);
+	for (int hilos : { 1, 2, 3, 5 }) {
+		int totalParalelo = 0;
+		pair<int, vector<int>> paralelo = monedasPDVectorParalelo<T>(M, C, totalParalelo, hilos);
+		COMPROBAR(paralelo == secuencial);
+		COMPROBAR(totalParalelo == total);
+	}
+}
+
+// Comprueba los tres tipos de celda (los que puedan representar la solución) y la versión sin plantilla
+static void comprobarCantidad(vector<int> const &M, int C, int esperado) {
+	comprobarCelda<uint8_t>(M, C, esperado);
+	comprobarCelda<uint16_t>(M, C, esperado);
+	comprobarCelda<uint32_t>(M, C, esperado);
+	int total = 0;
+	COMPROBAR(monedasPDVector(M, C, total).first == esperado);
+}
+
+int main() {
+	mt19937 g(20240607);
+
+	// Monedas justo por debajo, en y por encima del ancho de los registros vectoriales (8, 16, 32 y 64 celdas
+	// según el tipo y las instrucciones), para pasar por la versión vectorial, la escalar y el final del vector
+	for (int ancho : { 8, 16, 32, 64 }) {
+		for (int prueba = 0; prueba < 40; ++prueba) {
+			vector<int> M = sistemaAleatorio(g, 1 + prueba % 4, 3 * ancho, prueba % 3 == 0);
+			M.push_back(ancho - 1 + prueba % 3);
+			sort(M.begin(), M.end());
+			M.erase(unique(M.begin(), M.end()), M.end());
+			vector<int> minimo = minimosReferencia(M, 3000);
+			for (int C = 0; C <= 3000; C += 1 + (int)(g() % 97))
+				comprobarCantidad(M, C, minimo[C]);
+			for (int C = 2990; C <= 3000; ++C)
+				comprobarCantidad(M, C, minimo[C]);
+		}
+	}
+
+	// Cantidades que ocupan varios bloques de 128 KB (32768, 65536 y 131072 celdas según el tipo), con monedas
+	// más grandes que un bloque, y las cantidades de los bordes de los bloques
+	vector<vector<int>> sistemas = { { 1, 7, 300, 40000 }, { 5, 12, 9000, 70001 }, { 2000, 2047, 4099, 150000 },
+		{ 3, 32768, 65535 }, { 6, 10, 15 } };
+	for (vector<int> const &M : sistemas) {
+		vector<int> minimo = minimosReferencia(M, 400000);
+		for (int C : { 32767, 32768, 32769, 65536, 65537, 131071, 131072, 131073, 262145, 399999, 400000 })
+			comprobarCantidad(M, C, minimo[C]);
+	}
+
+	// Versión paralela: por ventanas (la moneda más pequeña es al menos VENTANA_MINIMA = 4096) y en cadena
+	// (con la moneda 1), con cantidades de varios bloques y más hilos que monedas
+	vector<vector<int>> paralelos = { { 4096, 4097, 5000, 9999 }, { 4100, 70000 }, { 5000 }, { 1, 7, 300, 40000 },
+		{ 1, 2 }, { 3, 32768, 65535 }, { 2000, 2047, 4099, 150000 } };
+	for (vector<int> const &M : paralelos) {
+		vector<int> minimo = minimosReferencia(M, 300000);
+		for (int C : { 0, 1, 4095, 4096, 8193, 131073, 299999, 300000 }) {
+			comprobarParalelo<uint8_t>(M, C);
+			comprobarParalelo<uint16_t>(M, C);
+			comprobarParalelo<uint32_t>(M, C);
+			int total = 0;
+			COMPROBAR(monedasPDVectorParalelo(M, C, total, 4).first == minimo[C]);
+		}
+	}
+
+	// El adaptador da lo mismo que el secuencial, tanto con cantidades pequeñas (un hilo) como grandes
+	for (int C : { 30, 1000, 3000000 }) {
+		vector<int> M = { 1, 5, 12, 25 };
+		Resultado paralelo = resolverPDParalelo(M, C);
+		Resultado secuencial = resolverPDVector(M, C);
+		COMPROBAR(paralelo.total == secuencial.total && paralelo.cuantas == secuencial.cuantas);
+	}
+
+	// Casos límite: sin monedas, C = 0 y una sola moneda
+	comprobarCantidad({}, 0, 0);
+	comprobarCantidad({}, 5, INT_MAX);
+	comprobarCantidad({ 7 }, 0, 0);
+	comprobarCantidad({ 7 }, 700, 100);
+	comprobarCantidad({ 7 }, 701, INT_MAX);
+
+	return terminar("PDVector");
+}
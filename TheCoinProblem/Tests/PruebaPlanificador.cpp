@@ -0,0 +1,153 @@
+/*
+	Problema de las monedas
+
+	Pruebas del planificador (Planificador.h)
+
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
+	Universidad Complutense de Madrid
+
+	Beatriz Herguedas Pinedo
+*/
+
+#include <climits>
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Comprobar.h"
+#include "Monedas.h"
+#include "Planificador.h"
+
+using namespace std;
+
+// Nombre del algoritmo elegido ("" si no hay ninguno)
+static string elegido(Plan const &p) {
+	return p.algoritmo == nullptr ? "" : p.algoritmo->nombre;
+}
+
+int main() {
+	mt19937 g(20240614);
+	Planificador planificador;
+
+	// Sistema canónico: el método voraz, para cualquier cantidad
+	COMPROBAR(elegido(planificador.planificar({ 1, 2, 5, 10, 20, 50 }, 1000000)) == "Voraz1");
+
+	// Sistema no canónico {1, 3, 4}, cuyo menor contraejemplo es 6: el voraz solo por debajo
+	COMPROBAR(elegido(planificador.planificar({ 1, 3, 4 }, 5)) == "Voraz1");
+	COMPROBAR(elegido(planificador.planificar({ 1, 3, 4 }, 1000)) == "PDVector");
+
+	// Con monedas grandes la solución tiene pocas monedas y la búsqueda en anchura es más barata, salvo si
+	// el voraz necesita muchas monedas (63000 = 6 * 10000 + 3000 * 1) o la cantidad es muy grande
+	vector<int> grandes = { 1, 7000, 9000, 10000 };
+	Plan p = planificador.planificar(grandes, 70000);
+	COMPROBAR(elegido(p) == "BFS");
+	COMPROBAR(elegido(planificador.planificar(grandes, 63000)) == "PDVector");
+	COMPROBAR(elegido(planificador.planificar(grandes, 2000000)) == "PDVector");
+
+	// Si se pide la tabla completa, la matriz, y ninguno si no cabe
+	COMPROBAR(elegido(planificador.planificar({ 1, 3, 4 }, 1000, true)) == "PDMatriz");
+	planificador.memoriaMaxima = 1e5;
+	p = planificador.planificar({ 1, 3, 4 }, 1000000, true);
+	COMPROBAR(p.algoritmo == nullptr && p.memoria > planificador.memoriaMaxima);
+
+	// Si la programación dinámica no cabe y las monedas son pequeñas, los restos módulo la moneda mayor
+	p = planificador.planificar({ 1, 3, 4 }, 1000000);
+	COMPROBAR(elegido(p) == "Grandes" && p.memoria <= planificador.memoriaMaxima);
+
+	// Si tampoco, ramificación y poda con la cola acotada a la memoria, y ninguno si ni las tablas caben
+	vector<int> separadas = { 1, 40000, 50000 };
+	planificador.memoriaMaxima = 1e8;
+	p = planificador.planificar(separadas, 100000000);
+	COMPROBAR(elegido(p) == "RYP" || elegido(p) == "RYPParalelo");
+	COMPROBAR(p.maxNodos > 0 && p.memoria > 0 && p.memoria <= planificador.memoriaMaxima);
+	Resultado r = planificador.resolver(separadas, 100000000);
+	COMPROBAR(r.total == 2000 && desgloseValido(separadas, r.cuantas, 100000000, 2000));
+	planificador.memoriaMaxima = 1e6;
+	COMPROBAR(planificador.planificar(separadas, 100000000).algoritmo == nullptr);
+	COMPROBAR_LANZA(planificador.resolver(separadas, 100000000), length_error);
+
+	// La ramificación y poda acotada se rinde en vez de pasarse de memoria
+	int numNodos = 0;
+	vector<int> solucion;
+	COMPROBAR(monedasRPMinimo({ 13, 17, 19, 23, 29 }, 100000, 5, solucion, numNodos, 4) == -1);
+	COMPROBAR(monedasRPMinimoParalelo({ 13, 17, 19, 23, 29 }, 100000, 5, solucion, numNodos, 3, 4) == -1);
+	planificador.memoriaMaxima = 1e9;
+
+	// Existencias limitadas: con desglose si cabe su tabla, solo el total si cabe el vector, y si no ninguno
+	planificador.memoriaMaxima = 1e7;
+	vector<int> limitadas = { 1, 3, 7, 12, 30, 45, 60, 99 };
+	vector<int> limites = { 50, 40, 30, 20, 10, 8, 6, 4 };
+	p = planificador.planificarLimitada(limitadas, 1500);
+	COMPROBAR(elegido(p) == "PDLimitada" && !p.soloTotal && p.memoria <= planificador.memoriaMaxima);
+	Plan total = planificador.planificarLimitada(limitadas, 1500, false);
+	COMPROBAR(elegido(total) == "PDLimitada" && total.soloTotal && total.memoria < p.memoria);
+	p = planificador.planificarLimitada(limitadas, 400000);
+	COMPROBAR(elegido(p) == "PDLimitada" && p.soloTotal && p.memoria <= planificador.memoriaMaxima);
+	p = planificador.planificarLimitada(limitadas, 3000000);
+	COMPROBAR(p.algoritmo == nullptr);
+	for (int C = 0; C <= 1500; C += 37) {
+		int utilizadas = 0;
+		COMPROBAR(monedasPDLimitada(limitadas, limites, C, utilizadas).first == monedasPDLimitadaTotal(limitadas, limites, C));
+	}
+	planificador.memoriaMaxima = 1e9;
+
+	// Lo que elija, resuelve igual que la programación dinámica de referencia
+	for (int prueba = 0; prueba < 300; ++prueba) {
+		vector<int> M = sistemaAleatorio(g, 1 + prueba % 6, 200, prueba % 2 == 0);
+		vector<int> minimo = minimosReferencia(M, 5000);
+		int C = g() % 5001;
+		r = planificador.resolver(M, C);
+		COMPROBAR(r.total == minimo[C]);
+		if (r.total != INT_MAX)
+			COMPROBAR(desgloseValido(M, r.cuantas, C, r.total));
+	}
+
+	// Los contraejemplos guardados: más sistemas que posiciones, alternándolos desde varios hilos,
+	// dan siempre el mismo plan que la primera vez
+	vector<vector<int>> sistemas;
+	vector<string> planes;
+	for (int i = 0; i < 150; ++i) {
+		sistemas.push_back(sistemaAleatorio(g, 2 + i % 5, 100, true));
+		Plan q = planificador.planificar(sistemas.back(), 3000);
+		planes.push_back(elegido(q) + q.motivo);
+	}
+	vector<thread> hilos;
+	vector<int> distintos(4, 0);
+	for (int h = 0; h < 4; ++h) {
+		hilos.emplace_back([&, h]() {
+			for (int vuelta = 0; vuelta < 3; ++vuelta) {
+				for (size_t i = h; i < sistemas.size(); i += 1 + h) {
+					Plan q = planificador.planificar(sistemas[i], 3000);
+					distintos[h] += elegido(q) + q.motivo != planes[i];
+				}
+			}
+		});
+	}
+	for (thread &h : hilos)
+		h.join();
+	for (int d : distintos)
+		COMPROBAR(d == 0);
+
+	// Guardar y cargar los coeficientes: lo cargado se vuelve a guardar igual, y cambia las decisiones
+	COMPROBAR(planificador.guardar("PruebaCalibracion.txt"));
+	Planificador cargado;
+	COMPROBAR(cargado.cargar("PruebaCalibracion.txt"));
+	COMPROBAR(cargado.guardar("PruebaCalibracion2.txt"));
+	ifstream a("PruebaCalibracion.txt"), b("PruebaCalibracion2.txt");
+	string textoA((istreambuf_iterator<char>(a)), istreambuf_iterator<char>());
+	string textoB((istreambuf_iterator<char>(b)), istreambuf_iterator<char>());
+	COMPROBAR(!textoA.empty() && textoA == textoB);
+	ofstream("PruebaCalibracion.txt") << "bfs 1\n";
+	COMPROBAR(cargado.cargar("PruebaCalibracion.txt"));
+	COMPROBAR(elegido(cargado.planificar(grandes, 70000)) == "PDVector");
+	remove("PruebaCalibracion.txt");
+	remove("PruebaCalibracion2.txt");
+	COMPROBAR(!cargado.cargar("PruebaCalibracion.txt"));
+
+	return terminar("Planificador");
+}
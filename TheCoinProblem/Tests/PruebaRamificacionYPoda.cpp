@@ -0,0 +1,82 @@
+/*
+	Problema de las monedas
+
+	Pruebas de ramificación y poda (RamificaciónYPoda.cpp)
+
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
+	Universidad Complutense de Madrid
+
+	Beatriz Herguedas Pinedo
+*/
+
+#include <climits>
+#include <random>
+#include <vector>
+
+#include "Comprobar.h"
+#include "Monedas.h"
+
+using namespace std;
+
+// Comprueba las tres versiones de ramificación y poda sobre una entrada con el mínimo esperado
+static void comprobarEntrada(vector<int> const &M, int C, int esperado) {
+	int N = M.size();
+
+	vector<int> solucion;
+	int numNodos = 0;
+	COMPROBAR(monedasRPMinimo(M, C, N, solucion, numNodos) == esperado);
+	if (esperado != INT_MAX)
+		COMPROBAR(desgloseValido(M, solucion, C, esperado));
+
+	// La versión paralela devuelve el mismo total y el mismo desglose con cualquier número de hilos
+	for (int hilos : { 1, 2, 3, 4, 8 }) {
+		vector<int> paralela;
+		COMPROBAR(monedasRPMinimoParalelo(M, C, N, paralela, numNodos, hilos) == esperado);
+		COMPROBAR(paralela == solucion);
+	}
+
+	Resultado r = resolverRYP(M, C), rp = resolverRYPParalelo(M, C);
+	COMPROBAR(r.total == esperado && rp.total == esperado);
+	COMPROBAR(r.cuantas == solucion && rp.cuantas == solucion);
+
+	Espacio espacio;
+	vector<int> cuantas(N);
+	COMPROBAR(resolverRYPSinReservas(M, C, espacio, cuantas.data()) == esperado);
+	COMPROBAR(cuantas == solucion);
+}
+
+int main() {
+	mt19937 g(20240615);
+
+	// Sistemas aleatorios con y sin la moneda unidad (las cotas no la necesitan) contra la programación dinámica
+	for (int prueba = 0; prueba < 1500; ++prueba) {
+		vector<int> M = sistemaAleatorio(g, 1 + prueba % 7, 40, prueba % 2 == 0);
+		int C = g() % 150;
+		vector<int> minimo = minimosReferencia(M, C);
+		comprobarEntrada(M, C, minimo[C]);
+	}
+
+	// Cantidades más grandes, con colas en las que los hilos llegan a robarse nodos
+	for (int prueba = 0; prueba < 40; ++prueba) {
+		vector<int> M = sistemaAleatorio(g, 4 + prueba % 5, 500, prueba % 2 == 0);
+		int C = 1000 + g() % 9000;
+		vector<int> minimo = minimosReferencia(M, C);
+		comprobarEntrada(M, C, minimo[C]);
+	}
+
+	// Sistemas no canónicos en los que la cota voraz no es la óptima
+	comprobarEntrada({ 1, 3, 4 }, 6, 2);
+	comprobarEntrada({ 1, 5, 10, 12 }, 15, 2);
+	comprobarEntrada({ 1, 5, 10, 12 }, 20, 2);
+	comprobarEntrada({ 3, 7 }, 11, INT_MAX);
+	comprobarEntrada({ 4, 6 }, 9, INT_MAX);
+
+	// Cantidades cerca de INT_MAX, donde la clave de la tabla de dominancia no cabe en un int
+	comprobarEntrada({ 1073741823, 2147483646 }, 2147483646, 1);
+	comprobarEntrada({ 1000000000, 1073741823 }, 2147483646, 2);
+	comprobarEntrada({ 1073741824, 2147483647 }, INT_MAX, 1);
+	comprobarEntrada({ 3, 1073741824 }, INT_MAX, 357913942);
+
+	return terminar("RamificacionYPoda");
+}
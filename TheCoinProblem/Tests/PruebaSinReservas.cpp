@@ -0,0 +1,95 @@
+/*
+	Problema de las monedas
+
+	Pruebas de las versiones sin reservas de memoria de los algoritmos (resolverSinReservas)
+
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
+	Universidad Complutense de Madrid
+
+	Beatriz Herguedas Pinedo
+*/
+
+#include <atomic>
+#include <climits>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <vector>
+
+#include "Comprobar.h"
+#include "Monedas.h"
+
+using namespace std;
+
+// Contamos las reservas de memoria sustituyendo el operator new global (new[] también pasa por él)
+static atomic<long long> reservas(0);
+
+void *operator new(size_t n) {
+	++reservas;
+	if (void *p = malloc(n != 0 ? n : 1))
+		return p;
+	throw bad_alloc();
+}
+
+void operator delete(void *p) noexcept {
+	free(p);
+}
+
+void operator delete(void *p, size_t) noexcept {
+	free(p);
+}
+
+// Entrada de la prueba con el resultado de la versión que reserva memoria
+struct Entrada {
+	vector<int> M;
+	int C;
+	Resultado esperado;
+};
+
+/*
+  Comprueba la versión sin reservas del algoritmo a sobre todas las entradas con el mismo espacio: la primera
+  pasada lo hace crecer hasta la entrada más grande, y en la segunda no se tiene que pedir memoria
+*/
+static void comprobarAlgoritmo(Algoritmo const &a, vector<Entrada> const &entradas) {
+	Espacio espacio;
+	vector<int> cuantas;
+	for (int pasada = 0; pasada < 2; ++pasada) {
+		for (Entrada const &e : entradas) {
+			cuantas.assign(e.M.size(), -1);
+			long long antes = reservas.load();
+			int total = a.resolverSinReservas(e.M, e.C, espacio, cuantas.data());
+			if (pasada == 1)
+				COMPROBAR(reservas.load() == antes);
+			COMPROBAR(total == e.esperado.total);
+			if (total != INT_MAX)
+				COMPROBAR(cuantas == e.esperado.cuantas);
+
+			// Sin desglose, el mismo total
+			COMPROBAR(a.resolverSinReservas(e.M, e.C, espacio, nullptr) == total);
+		}
+	}
+}
+
+int main() {
+	mt19937 g(20240624);
+
+	for (Algoritmo const &a : algoritmos()) {
+		if (a.resolverSinReservas == nullptr)
+			continue;
+
+		// Sistemas con y sin la moneda unidad, y cantidades que no se pueden pagar
+		vector<Entrada> entradas;
+		for (int prueba = 0; prueba < 120; ++prueba) {
+			vector<int> M = sistemaAleatorio(g, 1 + prueba % 8, 200, prueba % 3 != 0);
+			int C = g() % 3000;
+			entradas.push_back({ M, C, a.resolver(M, C) });
+		}
+		entradas.push_back({ { 1, 3, 4 }, 6, a.resolver({ 1, 3, 4 }, 6) });
+		entradas.push_back({ { 4, 6 }, 9, a.resolver({ 4, 6 }, 9) });
+		entradas.push_back({ { 1, 2, 5 }, 0, a.resolver({ 1, 2, 5 }, 0) });
+		comprobarAlgoritmo(a, entradas);
+	}
+
+	return terminar("SinReservas");
+}
@@ -0,0 +1,97 @@
+/*
+	Problema de las monedas
+
+	Pruebas de la tabla precalculada de cambios (TablaCambio.h)
+
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
+	Universidad Complutense de Madrid
+
+	Beatriz Herguedas Pinedo
+*/
+
+#include <climits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "Comprobar.h"
+#include "TablaCambio.h"
+
+using namespace std;
+
+// Comprueba todas las consultas de la tabla contra la programación dinámica de referencia
+static void comprobarTabla(TablaCambio const &t, vector<int> const &M) {
+	vector<int> minimo = minimosReferencia(M, t.maximo());
+	for (int C = 0; C <= t.maximo(); ++C) {
+		COMPROBAR(t.minimo(C) == minimo[C]);
+		vector<int> cuantas = t.cuantas(C);
+		vector<int> sol;
+		t.desglose(C, sol);
+		if (minimo[C] == INT_MAX) {
+			COMPROBAR(cuantas.empty());
+			COMPROBAR(sol.empty());
+			continue;
+		}
+		COMPROBAR(desgloseValido(M, cuantas, C, minimo[C]));
+		long long suma = 0;
+		for (int s : sol)
+			suma += s;
+		COMPROBAR(suma == C && (int)sol.size() == minimo[C]);
+	}
+}
+
+int main() {
+	mt19937 g(20240604);
+
+	// Consultas sobre sistemas con y sin la moneda unidad (con cantidades que no se pueden alcanzar)
+	for (int prueba = 0; prueba < 500; ++prueba) {
+		vector<int> M = sistemaAleatorio(g, 1 + prueba % 6, 60, prueba % 2 == 0);
+		TablaCambio t(M, g() % 2000);
+		COMPROBAR(t.tipos() == M);
+		comprobarTabla(t, M);
+	}
+
+	// Ampliar por tramos (rellenar desde el máximo anterior) da los mismos mínimos que la tabla construida
+	// de una vez, y desgloses válidos aunque con empates pueden ser otros
+	for (int prueba = 0; prueba < 300; ++prueba) {
+		vector<int> M = sistemaAleatorio(g, 1 + prueba % 5, 80, prueba % 3 != 0);
+		int maximo = g() % 50;
+		TablaCambio t(M, maximo);
+		for (int tramo = 0; tramo < 6; ++tramo) {
+			int nuevo = maximo + (int)(g() % 300);
+			TablaCambio copia = t.ampliada(nuevo);
+			COMPROBAR(t.maximo() == maximo);
+			t.ampliar(nuevo);
+			COMPROBAR(t.maximo() == nuevo && copia.maximo() == nuevo);
+			maximo = nuevo;
+		}
+		TablaCambio entera(M, maximo);
+		for (int C = 0; C <= maximo; ++C)
+			COMPROBAR(t.minimo(C) == entera.minimo(C));
+		comprobarTabla(t, M);
+
+		// Ampliar a un máximo menor no cambia nada
+		t.ampliar(maximo / 2);
+		COMPROBAR(t.maximo() == maximo);
+	}
+
+	// Cantidades fuera de la tabla
+	TablaCambio t({ 2, 5 }, 100);
+	COMPROBAR(t.minimo(0) == 0 && t.minimo(1) == INT_MAX && t.minimo(100) == 20);
+	COMPROBAR_LANZA(t.minimo(101), out_of_range);
+	COMPROBAR_LANZA(t.minimo(-1), out_of_range);
+	COMPROBAR_LANZA(t.cuantas(101), out_of_range);
+
+	// Parámetros no válidos, que se rechazan antes de reservar la tabla
+	COMPROBAR_LANZA(TablaCambio({ 1, 2 }, -1), invalid_argument);
+	COMPROBAR_LANZA(TablaCambio({ 1, 2 }, INT_MIN), invalid_argument);
+	COMPROBAR_LANZA(TablaCambio({ 1, 2 }, INT_MAX), length_error);
+	COMPROBAR_LANZA(TablaCambio({ 0, 2 }, 10), invalid_argument);
+	COMPROBAR_LANZA(TablaCambio({ 3, -2 }, 10), invalid_argument);
+	COMPROBAR(TablaCambio({}, 0).minimo(0) == 0);
+	COMPROBAR_LANZA(t.ampliar(INT_MAX), length_error);
+	COMPROBAR(t.maximo() == 100);
+
+	return terminar("TablaCambio");
+}
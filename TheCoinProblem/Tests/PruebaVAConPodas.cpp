@@ -0,0 +1,66 @@
+/*
+	Problema de las monedas
+
+	Pruebas de la vuelta atrás con podas y tabla de estados (VAConPodas.cpp)
+
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
+	Universidad Complutense de Madrid
+
+	Beatriz Herguedas Pinedo
+*/
+
+#include <climits>
+#include <random>
+#include <vector>
+
+#include "Comprobar.h"
+#include "Monedas.h"
+
+using namespace std;
+
+// Tamaños de la tabla de estados que probamos: sin tabla, con una diminuta (muchas colisiones) y con una grande
+long long const MEMORIAS[] = { 0, 64, 64LL << 20 };
+
+// Comprueba la vuelta atrás con podas con cada tamaño de tabla y la versión sin reservas
+static void comprobarEntrada(vector<int> const &M, int C, int esperado) {
+	for (long long memoria : MEMORIAS) {
+		vector<int> cuantas;
+		long long nodos = 0;
+		COMPROBAR(vueltaAtrasPodada(M, C, cuantas, memoria, nodos) == esperado);
+		if (esperado != INT_MAX)
+			COMPROBAR(desgloseValido(M, cuantas, C, esperado));
+	}
+
+	Espacio espacio;
+	vector<int> cuantas(M.size());
+	for (int vez = 0; vez < 2; ++vez) {
+		COMPROBAR(resolverVAPodasSinReservas(M, C, espacio, cuantas.data()) == esperado);
+		if (esperado != INT_MAX)
+			COMPROBAR(desgloseValido(M, cuantas, C, esperado));
+	}
+}
+
+int main() {
+	mt19937 g(20240617);
+
+	// Sistemas aleatorios con y sin la moneda unidad contra la programación dinámica
+	for (int prueba = 0; prueba < 1500; ++prueba) {
+		vector<int> M = sistemaAleatorio(g, 1 + prueba % 7, 40, prueba % 2 == 0);
+		int C = g() % 150;
+		vector<int> minimo = minimosReferencia(M, C);
+		comprobarEntrada(M, C, minimo[C]);
+	}
+
+	// Casos sin solución y sistemas no canónicos
+	comprobarEntrada({ 1, 3, 4 }, 6, 2);
+	comprobarEntrada({ 3, 7 }, 11, INT_MAX);
+	comprobarEntrada({ 4, 6 }, 9, INT_MAX);
+	comprobarEntrada({ 5 }, 0, 0);
+
+	// Cantidades cerca de INT_MAX, donde la clave de la tabla y el redondeo de la cota no caben en un int
+	comprobarEntrada({ 1073741824, 2147483647 }, INT_MAX, 1);
+	comprobarEntrada({ 1000000000, 1073741823 }, 2147483646, 2);
+
+	return terminar("VAConPodas");
+}
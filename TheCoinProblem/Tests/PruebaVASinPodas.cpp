@@ -0,0 +1,56 @@
+/*
+	Problema de las monedas
+
+	Pruebas de la vuelta atrás sin podas (VASinPodas.cpp)
+
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
+	Universidad Complutense de Madrid
+
+	Beatriz Herguedas Pinedo
+*/
+
+#include <climits>
+#include <random>
+#include <vector>
+
+#include "Comprobar.h"
+#include "Monedas.h"
+
+using namespace std;
+
+// Comprueba la versión secuencial y la paralela (con varios hilos y niveles de reparto) sobre una entrada
+static void comprobarEntrada(vector<int> const &M, int C, int esperado) {
+	int N = M.size();
+	COMPROBAR(vueltaAtras(C, N - 1, 0, M) == esperado);
+	for (int hilos : { 1, 2, 3, 5 })
+		for (int niveles : { 0, 1, 2, N })
+			COMPROBAR(vueltaAtrasParalelo(C, M, hilos, niveles) == esperado);
+	COMPROBAR(resolverVA(M, C).total == esperado);
+	COMPROBAR(resolverVAParalelo(M, C).total == esperado);
+}
+
+int main() {
+	mt19937 g(20240620);
+
+	// Sistemas aleatorios con y sin la moneda unidad contra la programación dinámica
+	for (int prueba = 0; prueba < 400; ++prueba) {
+		vector<int> M = sistemaAleatorio(g, 1 + prueba % 6, 30, prueba % 2 == 0);
+		int C = g() % 60;
+		vector<int> minimo = minimosReferencia(M, C);
+		comprobarEntrada(M, C, minimo[C]);
+	}
+
+	// Cantidad cero, cantidades que no se pueden pagar y sistemas no canónicos
+	comprobarEntrada({ 1, 2, 5 }, 0, 0);
+	comprobarEntrada({ 3, 7 }, 11, INT_MAX);
+	comprobarEntrada({ 4, 6 }, 9, INT_MAX);
+	comprobarEntrada({ 1, 3, 4 }, 6, 2);
+	comprobarEntrada({ 1, 5, 10, 12 }, 15, 2);
+
+	// Más tareas que hilos y tareas que ya han pagado la cantidad antes de repartirse
+	comprobarEntrada({ 1, 2, 5, 10, 20, 50 }, 99, 6);
+	comprobarEntrada({ 5, 10, 25 }, 50, 2);
+
+	return terminar("VASinPodas");
+}
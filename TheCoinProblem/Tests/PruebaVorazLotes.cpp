@@ -0,0 +1,102 @@
+/*
+	Problema de las monedas
+
+	Pruebas del método voraz por lotes (VorazLotes.cpp)
+
+	Métodos algorítmicos en Resolución de Problemas
+	Facultad de Informática
+	Universidad Complutense de Madrid
+
+	Beatriz Herguedas Pinedo
+*/
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "Comprobar.h"
+#include "Monedas.h"
+#include "VorazLotes.h"
+
+using namespace std;
+
+/*
+  Comprueba cada carril de VorazLotes contra monedasVoraz1 para las cantidades de un lote de n elementos,
+  empezando en la posición desde de cantidades (para que los accesos no estén alineados)
+*/
+static void comprobarLote(vector<int> const &M, vector<int32_t> const &cantidades, size_t desde, size_t n) {
+	int N = M.size();
+	VorazLotes lotes(M);
+	size_t paso = n + 3;
+	vector<int32_t> cuantas(N * paso + 1, -1), totales(n + 1, -1), soloTotales(n + 1, -1);
+	lotes.resolver(cantidades.data() + desde, n, cuantas.data() + 1, paso, totales.data() + 1);
+	lotes.resolver(cantidades.data() + desde, n, nullptr, paso, soloTotales.data() + 1);
+
+	for (size_t j = 0; j < n; ++j) {
+		int C = cantidades[desde + j];
+		int totalutilizadas = 0;
+		vector<pair<int, int>> w;
+		vector<int> voraz = monedasVoraz1(M, C, totalutilizadas, w);
+		for (int i = 0; i < N; ++i)
+			COMPROBAR(cuantas[1 + i * paso + j] == voraz[i]);
+		COMPROBAR(totales[1 + j] == resolverVoraz1(M, C).total);
+		COMPROBAR(soloTotales[1 + j] == totales[1 + j]);
+	}
+	// Fuera del lote no se escribe nada
+	COMPROBAR(totales[0] == -1 && cuantas[0] == -1);
+}
+
+int main() {
+	mt19937 g(20240622);
+
+	// Monedas alrededor de las potencias de dos, donde cambia el desplazamiento, y las mayores posibles
+	vector<int> candidatas = { 1, INT_MAX - 1, INT_MAX };
+	for (int p = 1; p <= 30; ++p) {
+		candidatas.push_back((1 << p) - 1);
+		candidatas.push_back(1 << p);
+		candidatas.push_back((1 << p) + 1);
+	}
+	sort(candidatas.begin(), candidatas.end());
+	candidatas.erase(unique(candidatas.begin(), candidatas.end()), candidatas.end());
+
+	// Cantidades cerca de INT_MAX y de las potencias de dos, y aleatorias
+	vector<int32_t> cantidades;
+	for (int k = 0; k < 64; ++k) {
+		cantidades.push_back(INT_MAX - k);
+		cantidades.push_back(k);
+	}
+	for (int p = 1; p <= 30; ++p) {
+		cantidades.push_back((1 << p) - 1);
+		cantidades.push_back(1 << p);
+		cantidades.push_back((1 << p) + 1);
+	}
+	for (int k = 0; k < 400; ++k)
+		cantidades.push_back(g() % ((uint32_t)INT_MAX + 1));
+	shuffle(cantidades.begin(), cantidades.end(), g);
+
+	// Lotes con longitudes que no son múltiplo de 8 y sistemas con y sin la moneda unidad
+	for (int prueba = 0; prueba < 300; ++prueba) {
+		vector<int> M;
+		int N = 1 + prueba % 6;
+		while ((int)M.size() < N) {
+			int m = candidatas[g() % candidatas.size()];
+			if (find(M.begin(), M.end(), m) == M.end())
+				M.push_back(m);
+		}
+		if (prueba % 2 == 0 && find(M.begin(), M.end(), 1) == M.end())
+			M.push_back(1);
+		sort(M.begin(), M.end());
+		size_t n = prueba % 41;
+		size_t desde = g() % (cantidades.size() - n);
+		comprobarLote(M, cantidades, desde, n);
+	}
+
+	// Todas las cantidades con cada moneda sola, que es donde la división tiene que ser exacta
+	for (int m : candidatas)
+		comprobarLote({ m }, cantidades, 0, cantidades.size());
+	comprobarLote({ 1, 2, 5, 10, 20, 50, 100, 200 }, cantidades, 3, cantidades.size() - 3);
+
+	return terminar("VorazLotes");
+}
@@ -0,0 +1,21 @@
+#!/bin/sh
+# Compila y ejecuta todas las pruebas automáticas
+#
+# Uso: TheCoinProblem/Tests/ejecutar.sh [opciones de g++]
+# (por ejemplo -I<directorio de Matriz.h>; la variable CXX elige el compilador)
+
+cd "$(dirname "$0")" || exit 1
+CXX=${CXX:-g++}
+ALGORITMOS=$(ls ../Algorithms/*.cpp | grep -v Pruebas.cpp)
+mkdir -p build
+resultado=0
+for prueba in Prueba*.cpp; do
+	nombre=build/${prueba%.cpp}
+	if ! $CXX -std=c++17 -O2 -pthread -I../Algorithms "$@" "$prueba" $ALGORITMOS -o "$nombre"; then
+		echo "$prueba: no compila"
+		resultado=1
+	elif ! "./$nombre"; then
+		resultado=1
+	fi
+done
+exit $resultado